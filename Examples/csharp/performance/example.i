@@ -0,0 +1,23 @@
+/* File : example.i */
+%module example
+
+// The fast variants are trivial non-blocking calls which can skip the GC transition
+// and FastParticle::x is passed the this pointer as a blittable IntPtr
+%cssuppressgctransition fast_add;
+%cssuppressgctransition FastParticle::x;
+%csunsafepointers FastParticle::x;
+
+%inline %{
+int slow_add(int a, int b) { return a + b; }
+int fast_add(int a, int b) { return a + b; }
+
+struct SlowParticle {
+  double x;
+  SlowParticle() : x(0.0) {}
+};
+
+struct FastParticle {
+  double x;
+  FastParticle() : x(0.0) {}
+};
+%}
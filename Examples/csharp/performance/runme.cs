@@ -0,0 +1,59 @@
+// Micro benchmarks in the style of BenchmarkDotNet comparing regular P/Invoke
+// calls with calls marked with %cssuppressgctransition and %csunsafepointers.
+
+using System;
+using System.Diagnostics;
+
+public class runme
+{
+    const int Iterations = 10000000;
+    const int Runs = 5;
+
+    delegate void Benchmark(int iterations);
+
+    static void Run(string name, Benchmark benchmark)
+    {
+        // Warm up so that the JIT compiles the method and the P/Invoke stubs before measuring
+        benchmark(Iterations / 10);
+
+        double best = double.MaxValue;
+        double total = 0.0;
+        for (int run = 0; run < Runs; ++run) {
+            Stopwatch watch = Stopwatch.StartNew();
+            benchmark(Iterations);
+            watch.Stop();
+            double ns = watch.Elapsed.TotalMilliseconds * 1e6 / Iterations;
+            best = Math.Min(best, ns);
+            total += ns;
+        }
+        Console.WriteLine("| {0,-24} | {1,10:F2} ns | {2,10:F2} ns |", name, total / Runs, best);
+    }
+
+    static void Main()
+    {
+        SlowParticle slow = new SlowParticle();
+        FastParticle fast = new FastParticle();
+
+        Console.WriteLine("| {0,-24} | {1,13} | {2,13} |", "Method", "Mean", "Min");
+        Console.WriteLine("|--------------------------|---------------|---------------|");
+
+        Run("slow_add", delegate(int n) {
+            int sum = 0;
+            for (int i = 0; i < n; ++i)
+                sum = example.slow_add(sum, 1);
+        });
+        Run("fast_add", delegate(int n) {
+            int sum = 0;
+            for (int i = 0; i < n; ++i)
+                sum = example.fast_add(sum, 1);
+        });
+        Run("SlowParticle.x get/set", delegate(int n) {
+            for (int i = 0; i < n; ++i)
+                slow.x = slow.x + 1.0;
+        });
+        Run("FastParticle.x get/set", delegate(int n) {
+            for (int i = 0; i < n; ++i)
+                fast.x = fast.x + 1.0;
+        });
+    }
+}
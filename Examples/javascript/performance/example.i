@@ -0,0 +1,24 @@
+/* File : example.i */
+%module example
+
+// Build with -DINLINE_POINTERS to store unowned pointers in the object's internal fields
+#ifdef INLINE_POINTERS
+%begin %{
+#define SWIGV8_INLINE_POINTERS
+%}
+#endif
+
+%inline %{
+struct Point {
+  double x, y;
+  Point() : x(0.0), y(0.0) {}
+  double length2() const { return x*x + y*y; }
+};
+
+class Path {
+  Point points[16];
+public:
+  Point *point(int i) { return &points[i & 15]; }
+  Point at(int i) const { return points[i & 15]; }
+};
+%}
@@ -0,0 +1,35 @@
+// Times the creation of wrapped objects and calls through them.
+// Run once with the default build and once built with -DINLINE_POINTERS.
+var example = require("example");
+
+var iterations = 1000000;
+
+function run(name, fn) {
+  // warm up so that the functions are optimized before measuring
+  fn(iterations / 10);
+  var start = process.hrtime();
+  fn(iterations);
+  var elapsed = process.hrtime(start);
+  var ns = (elapsed[0] * 1e9 + elapsed[1]) / iterations;
+  console.log(name + ": " + ns.toFixed(1) + " ns");
+}
+
+var path = new example.Path();
+
+run("borrowed pointer (Path.point)", function(n) {
+  for (var i = 0; i < n; ++i)
+    path.point(i);
+});
+run("borrowed pointer + method call", function(n) {
+  var sum = 0;
+  for (var i = 0; i < n; ++i)
+    sum += path.point(i).length2();
+});
+run("owned object (Path.at)", function(n) {
+  for (var i = 0; i < n; ++i)
+    path.at(i);
+});
+run("new Point", function(n) {
+  for (var i = 0; i < n; ++i)
+    new example.Point();
+});
@@ -0,0 +1,28 @@
+/* File : example.i */
+%module example
+
+%inline %{
+/* A deep class hierarchy where the most used members are in the root class */
+class Entity {
+public:
+  double x;
+  Entity() : x(0.0) {}
+  virtual ~Entity() {}
+  void move(double dx) { x += dx; }
+};
+
+class Level1 : public Entity {};
+class Level2 : public Level1 {};
+class Level3 : public Level2 {};
+class Level4 : public Level3 {};
+class Level5 : public Level4 {};
+class Level6 : public Level5 {};
+class Level7 : public Level6 {};
+
+class Player : public Level7 {
+public:
+  int score;
+  Player() : score(0) {}
+  void add_score(int points) { score += points; }
+};
+%}
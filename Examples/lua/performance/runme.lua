@@ -0,0 +1,26 @@
+-- file: runme.lua
+
+-- Benchmarks calling methods and accessing attributes inherited through
+-- a deep class hierarchy. The same module is built with no options
+-- (example_default), with -squash-bases (example_squash) and with
+-- -cache-bases (example_cache). The module to benchmark is given on the
+-- command line: lua runme.lua example_cache
+
+local module = arg and arg[1] or "example_default"
+local iterations = 1000000
+
+local function benchmark(name, run)
+	run(iterations / 10) -- warm up
+	local start = os.clock()
+	run(iterations)
+	local elapsed = os.clock() - start
+	print(string.format("  %-24s %8.1f ns/iteration", name, elapsed * 1e9 / iterations))
+end
+
+local m = require(module)
+local p = m.Player()
+print(module)
+benchmark("own method", function(n) for i = 1, n do p:add_score(1) end end)
+benchmark("inherited method", function(n) for i = 1, n do p:move(1.0) end end)
+benchmark("inherited attribute get", function(n) local x for i = 1, n do x = p.x end end)
+benchmark("inherited attribute set", function(n) for i = 1, n do p.x = i end end)
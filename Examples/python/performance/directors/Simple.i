@@ -0,0 +1,19 @@
+%module(directors="1") Simple
+
+%feature("director") MyClass;
+
+%inline %{
+class MyClass {
+public:
+    MyClass () {}
+    virtual ~MyClass () {}
+    virtual int func (int i) { return i; }
+};
+
+int call (MyClass *x, int n) {
+    int total = 0;
+    for (int i = 0; i < n; i++)
+        total += x->func(i);
+    return total;
+}
+%}
@@ -0,0 +1,17 @@
+import sys
+sys.path.append('..')
+import harness
+
+
+def proc(mod):
+    class Derived(mod.MyClass):
+
+        def func(self, i):
+            return 1
+
+    x = Derived()
+    mod.call(x, 5000000)
+    for i in range(200000):
+        mod.call(Derived(), 5)
+
+harness.run(proc)
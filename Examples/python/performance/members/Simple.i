@@ -0,0 +1,7 @@
+%inline %{
+struct MyClass {
+    MyClass () : x(0), y(0) {}
+    int x;
+    double y;
+};
+%}
@@ -0,0 +1,12 @@
+import sys
+sys.path.append('..')
+import harness
+
+
+def proc(mod):
+    x = mod.MyClass()
+    for i in range(10000000):
+        x.x = x.x + 1
+        x.y = x.y
+
+harness.run(proc)
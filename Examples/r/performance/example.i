@@ -0,0 +1,53 @@
+/* File : example.i */
+%module example
+
+/* Returns many wrapped objects in one call to measure the cost of creating
+   them.  points() builds S4 objects with SWIG_MakePtr, pointers() builds
+   plain pointer objects with SWIG_NewPointerObj. */
+
+%{
+#include <vector>
+%}
+
+%inline %{
+struct Point {
+  int x, y;
+};
+%}
+
+%{
+static std::vector<Point> pool;
+
+static std::vector<Point *> make_points(int n) {
+  pool.resize(n);
+  std::vector<Point *> result(n);
+  for (int i = 0; i < n; ++i) {
+    pool[i].x = i;
+    pool[i].y = -i;
+    result[i] = &pool[i];
+  }
+  return result;
+}
+%}
+
+%typemap(rtype) std::vector<Point *> "list"
+%typemap(scoerceout) std::vector<Point *> %{ %}
+
+%typemap(out) std::vector<Point *> points {
+  Rf_protect($result = Rf_allocVector(VECSXP, $1.size()));
+  for (size_t i = 0; i < $1.size(); ++i)
+    SET_VECTOR_ELT($result, i, SWIG_MakePtr($1[i], "_p_Point", R_SWIG_EXTERNAL));
+  Rf_unprotect(1);
+}
+
+%typemap(out) std::vector<Point *> pointers {
+  Rf_protect($result = Rf_allocVector(VECSXP, $1.size()));
+  for (size_t i = 0; i < $1.size(); ++i)
+    SET_VECTOR_ELT($result, i, SWIG_NewPointerObj($1[i], $descriptor(Point *), 0));
+  Rf_unprotect(1);
+}
+
+%inline %{
+std::vector<Point *> points(int n) { return make_points(n); }
+std::vector<Point *> pointers(int n) { return make_points(n); }
+%}
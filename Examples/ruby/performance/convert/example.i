@@ -0,0 +1,17 @@
+/* File : example.i */
+%module example
+
+%inline %{
+struct Vector {
+  double x, y, z;
+  Vector(double x = 0, double y = 0, double z = 0) : x(x), y(y), z(z) {}
+};
+
+struct Point : Vector {
+  Point(double x = 0, double y = 0, double z = 0) : Vector(x, y, z) {}
+};
+
+double triple_product(const Vector &a, const Vector &b, const Vector &c) {
+  return a.x * (b.y * c.z - b.z * c.y) - a.y * (b.x * c.z - b.z * c.x) + a.z * (b.x * c.y - b.y * c.x);
+}
+%}
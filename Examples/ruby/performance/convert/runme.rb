@@ -0,0 +1,21 @@
+# Measures the cost of converting wrapped objects passed as arguments
+
+require 'example'
+require 'harness'
+
+a = Example::Vector.new(1, 0, 0)
+b = Example::Vector.new(0, 1, 0)
+c = Example::Vector.new(0, 0, 1)
+p = Example::Point.new(0, 0, 1)
+
+Harness.run("triple_product(Vector, Vector, Vector)", 1000000) do |n|
+  n.times { Example.triple_product(a, b, c) }
+end
+
+Harness.run("triple_product(Vector, Vector, Point)", 1000000) do |n|
+  n.times { Example.triple_product(a, b, p) }
+end
+
+Harness.run("Vector.new", 1000000) do |n|
+  n.times { Example::Vector.new }
+end
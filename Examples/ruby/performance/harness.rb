@@ -0,0 +1,19 @@
+# Runs a benchmark block several times and reports the best time per iteration
+
+module Harness
+  RUNS = 5
+
+  def self.run(name, iterations)
+    # Warm up
+    yield(iterations / 10)
+
+    best = nil
+    RUNS.times do
+      start = Process.clock_gettime(Process::CLOCK_MONOTONIC)
+      yield(iterations)
+      elapsed = Process.clock_gettime(Process::CLOCK_MONOTONIC) - start
+      best = elapsed if best.nil? || elapsed < best
+    end
+    printf("%-40s %10.1f ns/iteration\n", name, best * 1e9 / iterations)
+  end
+end
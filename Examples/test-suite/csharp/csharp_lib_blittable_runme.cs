@@ -0,0 +1,77 @@
+using System;
+using csharp_lib_blittableNamespace;
+
+public class runme
+{
+  static void Main() 
+  {
+    {
+      Vec3 v = csharp_lib_blittable.makeVec3(1.0, 2.0, 3.0);
+      CheckVec3(v, 1.0, 2.0, 3.0);
+
+      Vec3 w = csharp_lib_blittable.addVec3(v, v);
+      CheckVec3(w, 2.0, 4.0, 6.0);
+
+      csharp_lib_blittable.negateVec3(ref w);
+      CheckVec3(w, -2.0, -4.0, -6.0);
+    }
+
+    {
+      Segment s = new Segment();
+      s.start = csharp_lib_blittable.makeVec3(1.0, 1.0, 1.0);
+      s.end = csharp_lib_blittable.makeVec3(2.0, 3.0, 4.0);
+      s.id = 10;
+      if (csharp_lib_blittable.segmentLengthSquared(s) != 14.0)
+        throw new Exception("segmentLengthSquared failed");
+    }
+
+    {
+      Holder h = new Holder();
+      h.position = csharp_lib_blittable.makeVec3(4.0, 5.0, 6.0);
+      CheckVec3(h.position, 4.0, 5.0, 6.0);
+    }
+
+    {
+      CheckVec3(csharp_lib_blittable.checkedVec3(1.0), 1.0, 1.0, 1.0);
+      CheckVec3(csharp_lib_blittable.checkedVec3Ref(csharp_lib_blittable.makeVec3(1.0, 2.0, 3.0)), 1.0, 2.0, 3.0);
+      bool thrown = false;
+      try {
+        csharp_lib_blittable.checkedVec3(-1.0);
+      } catch (ApplicationException) {
+        thrown = true;
+      }
+      if (!thrown)
+        throw new Exception("checkedVec3 did not throw");
+      thrown = false;
+      try {
+        csharp_lib_blittable.checkedVec3Ref(csharp_lib_blittable.makeVec3(-1.0, 2.0, 3.0));
+      } catch (ApplicationException) {
+        thrown = true;
+      }
+      if (!thrown)
+        throw new Exception("checkedVec3Ref did not throw");
+    }
+
+    {
+      Vec3[] points = new Vec3[10];
+      for (int i=0; i<points.Length; ++i)
+        points[i] = csharp_lib_blittable.makeVec3(i, 2*i, 3*i);
+
+      CheckVec3(csharp_lib_blittable.sumVec3s(points, points.Length), 45.0, 90.0, 135.0);
+
+      Vec3[] scaled = new Vec3[points.Length];
+      csharp_lib_blittable.scaleVec3s(points, scaled, points.Length, 0.5);
+      for (int i=0; i<points.Length; ++i)
+        CheckVec3(scaled[i], 0.5*i, i, 1.5*i);
+
+      csharp_lib_blittable.reverseVec3s(points, points.Length);
+      for (int i=0; i<points.Length; ++i)
+        CheckVec3(points[i], 9-i, 2*(9-i), 3*(9-i));
+    }
+  }
+
+  static void CheckVec3(Vec3 v, double x, double y, double z) {
+    if (v.x != x || v.y != y || v.z != z)
+      throw new Exception("Vec3 (" + v.x + ", " + v.y + ", " + v.z + ") does not match (" + x + ", " + y + ", " + z + ")");
+  }
+}
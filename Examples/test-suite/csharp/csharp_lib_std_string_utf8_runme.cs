@@ -0,0 +1,59 @@
+using System;
+using csharp_lib_std_string_utf8Namespace;
+
+public class runme
+{
+  static void Main() 
+  {
+    {
+      if (csharp_lib_std_string_utf8.echo("hello") != "hello")
+        throw new Exception("echo failed");
+
+      string unicode = "grüß 你好 \U0001F600";
+      if (csharp_lib_std_string_utf8.echo(unicode) != unicode)
+        throw new Exception("echo unicode failed");
+
+      if (csharp_lib_std_string_utf8.echo_ref(unicode) != unicode)
+        throw new Exception("echo_ref unicode failed");
+
+      if (csharp_lib_std_string_utf8.echo("") != "")
+        throw new Exception("echo empty failed");
+
+      if (csharp_lib_std_string_utf8.concat("ab", "cd") != "abcd")
+        throw new Exception("concat failed");
+    }
+
+    {
+      string[] parts = csharp_lib_std_string_utf8.split("a,été,,b", ',');
+      if (parts.Length != 4 || parts[0] != "a" || parts[1] != "été" || parts[2] != "" || parts[3] != "b")
+        throw new Exception("split failed");
+
+      if (csharp_lib_std_string_utf8.empty_strings().Length != 0)
+        throw new Exception("empty_strings failed");
+    }
+
+    {
+      StringVector v = new StringVector();
+      v.Add("über");
+      v.Add("x");
+      if (v[0] != "über" || v[1] != "x")
+        throw new Exception("StringVector failed");
+
+      string[] copy = csharp_lib_std_string_utf8.echo_vector_ref(v);
+      if (copy.Length != 2 || copy[0] != "über" || copy[1] != "x")
+        throw new Exception("echo_vector_ref failed");
+    }
+
+    {
+      Person p = new Person();
+      p.name = "Zoë";
+      if (p.name != "Zoë")
+        throw new Exception("Person.name failed");
+      if (p.name_ref() != "Zoë")
+        throw new Exception("Person.name_ref failed");
+
+      if (csharp_lib_std_string_utf8.global_name != "global")
+        throw new Exception("global_name failed");
+    }
+  }
+}
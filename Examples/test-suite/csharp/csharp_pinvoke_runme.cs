@@ -0,0 +1,64 @@
+using System;
+using System.Reflection;
+using csharp_pinvokeNamespace;
+
+public class runme
+{
+  static readonly Type suppressGCTransition = typeof(object).Assembly.GetType("System.Runtime.InteropServices.SuppressGCTransitionAttribute");
+
+  static void Main() 
+  {
+    Type imclass = typeof(csharp_pinvokePINVOKE);
+
+    // cs:suppressgctransition
+    CheckSuppressGCTransition(imclass, "Counter_value_get", true);
+    CheckSuppressGCTransition(imclass, "Counter_value_set", true);
+    CheckSuppressGCTransition(imclass, "add", true);
+    CheckSuppressGCTransition(imclass, "Counter_increase", false);
+    if (csharp_pinvoke.add(1, 2) != 3)
+      throw new Exception("add failed");
+
+    // cs:unsafepointers
+    CheckParameters(imclass, "new_Counter__SWIG_1", typeof(IntPtr));
+    CheckParameters(imclass, "Counter_increase", typeof(IntPtr), typeof(IntPtr));
+    CheckParameters(imclass, "sumCounters", typeof(IntPtr), typeof(IntPtr));
+    CheckParameters(imclass, "Counter_value_get", typeof(System.Runtime.InteropServices.HandleRef));
+
+    Counter a = new Counter(10);
+    Counter b = new Counter(a);
+    b.increase(new Counter(5));
+    if (a.value != 10 || b.value != 15)
+      throw new Exception("increase failed");
+    if (csharp_pinvoke.sumCounters(a, b) != 25)
+      throw new Exception("sumCounters failed");
+
+    // cs:unsafepointers on variables
+    CheckParameters(imclass, "Counter_count_set", typeof(IntPtr), typeof(int));
+    CheckParameters(imclass, "Counter_count_get", typeof(IntPtr));
+    CheckParameters(imclass, "globalCounter_set", typeof(IntPtr));
+    b.count = 4;
+    if (b.count != 4)
+      throw new Exception("count failed");
+    csharp_pinvoke.globalCounter = b;
+    if (csharp_pinvoke.globalCounter.value != 15)
+      throw new Exception("globalCounter failed");
+  }
+
+  static void CheckSuppressGCTransition(Type imclass, string name, bool expected) {
+    if (suppressGCTransition == null)
+      return; // only available in .NET 5 and later
+    bool found = imclass.GetMethod(name).IsDefined(suppressGCTransition, false);
+    if (found != expected)
+      throw new Exception("SuppressGCTransition attribute on " + name + " is " + found);
+  }
+
+  static void CheckParameters(Type imclass, string name, params Type[] types) {
+    ParameterInfo[] parameters = imclass.GetMethod(name).GetParameters();
+    if (parameters.Length != types.Length)
+      throw new Exception("Wrong number of parameters for " + name);
+    for (int i = 0; i < types.Length; i++)
+      if (parameters[i].ParameterType != types[i])
+        throw new Exception("Parameter " + i + " of " + name + " is " + parameters[i].ParameterType);
+  }
+}
+
@@ -528,6 +528,36 @@ public class li_std_vector_runme {
       li_std_vector.halve_in_place(dvec);
     }
 
+    // Bulk array copies for primitive types
+    {
+      DoubleVector dv = new DoubleVector(new double[] { 1.5, 2.5, 3.5 });
+      double[] da = dv.ToArray();
+      if (da.Length != 3 || da[0] != 1.5 || da[2] != 3.5)
+        throw new Exception("ToArray test failed");
+      dv.InsertRange(1, new double[] { 0.0, 10.0, 20.0 }, 1, 2);
+      dv.AddRange(new double[] { 30.0 }, 0, 1);
+      dv.SetRange(0, new double[] { -1.0, -2.0 }, 1, 1);
+      double[] expected = new double[] { -2.0, 10.0, 20.0, 2.5, 3.5, 30.0 };
+      da = new double[expected.Length + 1];
+      dv.CopyTo(0, da, 1, dv.Count);
+      for (int i=0; i<expected.Length; i++) {
+        if (da[i+1] != expected[i])
+          throw new Exception("Bulk copy test failed, i:" + i);
+      }
+      try {
+        dv.InsertRange(dv.Count + 1, new double[] { 1.0 }, 0, 1);
+        throw new Exception("InsertRange array index test failed");
+      } catch (ArgumentOutOfRangeException) {
+      }
+      try {
+        dv.SetRange(0, new double[] { 1.0 }, 0, 2);
+        throw new Exception("SetRange array count test failed");
+      } catch (ArgumentException) {
+      }
+      if (new IntVector(new int[0]).ToArray().Length != 0)
+        throw new Exception("Empty ToArray test failed");
+    }
+
     // Dispose()
     {
       using (StructVector vs = new StructVector( new Struct[] { new Struct(0.0), new Struct(11.1) } ) )
@@ -0,0 +1,91 @@
+%module csharp_lib_blittable
+
+%include "blittable.i"
+
+%csblittable(Vec3)
+%csblittable(Segment)
+
+%apply Vec3 INPUT[] { const Vec3 *points }
+%apply Vec3 OUTPUT[] { Vec3 *scaled }
+%apply Vec3 INOUT[] { Vec3 *inout }
+
+%catches(int) checkedVec3;
+%catches(int) checkedVec3Ref;
+
+%inline %{
+struct Vec3 {
+  double x, y, z;
+};
+
+struct Segment {
+  Vec3 start;
+  Vec3 end;
+  int id;
+};
+
+struct Holder {
+  Vec3 position;
+};
+
+Vec3 makeVec3(double x, double y, double z) {
+  Vec3 v = { x, y, z };
+  return v;
+}
+
+Vec3 addVec3(Vec3 a, const Vec3 &b) {
+  Vec3 v = { a.x + b.x, a.y + b.y, a.z + b.z };
+  return v;
+}
+
+Vec3 checkedVec3(double x) {
+  if (x < 0)
+    throw 1;
+  Vec3 v = { x, x, x };
+  return v;
+}
+
+const Vec3 &checkedVec3Ref(const Vec3 &v) {
+  if (v.x < 0)
+    throw 2;
+  return v;
+}
+
+void negateVec3(Vec3 &v) {
+  v.x = -v.x;
+  v.y = -v.y;
+  v.z = -v.z;
+}
+
+double segmentLengthSquared(const Segment &s) {
+  double dx = s.end.x - s.start.x;
+  double dy = s.end.y - s.start.y;
+  double dz = s.end.z - s.start.z;
+  return dx*dx + dy*dy + dz*dz;
+}
+
+Vec3 sumVec3s(const Vec3 *points, int count) {
+  Vec3 sum = { 0.0, 0.0, 0.0 };
+  for (int i = 0; i < count; ++i) {
+    sum.x += points[i].x;
+    sum.y += points[i].y;
+    sum.z += points[i].z;
+  }
+  return sum;
+}
+
+void scaleVec3s(const Vec3 *points, Vec3 *scaled, int count, double factor) {
+  for (int i = 0; i < count; ++i) {
+    scaled[i].x = points[i].x * factor;
+    scaled[i].y = points[i].y * factor;
+    scaled[i].z = points[i].z * factor;
+  }
+}
+
+void reverseVec3s(Vec3 *inout, int count) {
+  for (int i = 0; i < count/2; ++i) {
+    Vec3 tmp = inout[i];
+    inout[i] = inout[count - 1 - i];
+    inout[count - 1 - i] = tmp;
+  }
+}
+%}
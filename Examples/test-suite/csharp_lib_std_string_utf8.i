@@ -0,0 +1,42 @@
+%module csharp_lib_std_string_utf8
+
+%include "std_string_utf8.i"
+%include "std_vector.i"
+
+%template(StringVector) std::vector<std::string>;
+
+%inline %{
+#include <string>
+#include <vector>
+
+std::string echo(const std::string &s) { return s; }
+
+const std::string &echo_ref(const std::string &s) { return s; }
+
+std::string concat(std::string a, const std::string &b) { return a + b; }
+
+std::vector<std::string> split(const std::string &s, char sep) {
+  std::vector<std::string> result;
+  std::string::size_type start = 0, pos;
+  while ((pos = s.find(sep, start)) != std::string::npos) {
+    result.push_back(s.substr(start, pos - start));
+    start = pos + 1;
+  }
+  result.push_back(s.substr(start));
+  return result;
+}
+
+const std::vector<std::string> &empty_strings() {
+  static std::vector<std::string> v;
+  return v;
+}
+
+struct Person {
+  std::string name;
+  const std::string &name_ref() const { return name; }
+};
+
+std::string global_name = "global";
+
+const std::vector<std::string> &echo_vector_ref(const std::vector<std::string> &v) { return v; }
+%}
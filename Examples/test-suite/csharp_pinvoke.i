@@ -0,0 +1,32 @@
+/* Test the cs:suppressgctransition and cs:unsafepointers features on the intermediary class */
+
+%module csharp_pinvoke
+
+%cssuppressgctransition Counter::value;
+%cssuppressgctransition add;
+
+%csunsafepointers Counter::Counter(const Counter &);
+%csunsafepointers Counter::increase;
+%csunsafepointers sumCounters;
+%csunsafepointers Counter::count;
+%csunsafepointers globalCounter;
+
+%inline %{
+struct Counter {
+  int value;
+  int count;
+  Counter(int v) : value(v), count(0) {}
+  Counter(const Counter &other) : value(other.value), count(0) {}
+  void increase(const Counter &other) { value += other.value; }
+};
+
+int sumCounters(const Counter *a, const Counter &b) {
+  return a->value + b.value;
+}
+
+Counter globalCounter = Counter(1);
+
+int add(int a, int b) {
+  return a + b;
+}
+%}
@@ -0,0 +1,35 @@
+package main
+
+import "./go_batch"
+
+func main() {
+	args := []go_batch.Batch_addBatchArgs{{1, 2}, {3, 4}, {-5, 5}}
+	sums := go_batch.Batch_addBatch(args)
+	if len(sums) != 3 || sums[0] != 3 || sums[1] != 7 || sums[2] != 0 {
+		panic(sums)
+	}
+
+	if len(go_batch.Batch_addBatch(nil)) != 0 {
+		panic("empty batch")
+	}
+
+	scaled := go_batch.Batch_scaleBatch([]go_batch.Batch_scaleBatchArgs{{Value: 1.5, Factor: 2}, {Value: -1, Factor: 0.5}})
+	if scaled[0] != 3 || scaled[1] != -0.5 {
+		panic(scaled)
+	}
+
+	go_batch.Batch_touchBatch([]go_batch.Batch_touchBatchArgs{{1}, {2}, {3}})
+	if go_batch.GetBatch_total() != 6 {
+		panic(go_batch.GetBatch_total())
+	}
+
+	names := go_batch.Batch_nameBatch([]go_batch.Batch_nameBatchArgs{{0}, {1}})
+	if names[0] != "even" || names[1] != "odd" {
+		panic(names)
+	}
+
+	twice := go_batch.BatchUtilTwiceBatch([]go_batch.BatchUtilTwiceBatchArgs{{21}})
+	if twice[0] != 42 {
+		panic(twice)
+	}
+}
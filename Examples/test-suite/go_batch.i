@@ -0,0 +1,31 @@
+// Test %feature("go:batch").
+
+%module go_batch
+
+%warnfilter(SWIGWARN_GO_BATCH) batch_name;
+
+%feature("go:batch") batch_add;
+%feature("go:batch") batch_scale;
+%feature("go:batch") batch_touch;
+%feature("go:batch") batch_name;
+%feature("go:batch") BatchUtil::twice;
+
+%inline
+%{
+
+int batch_add(int x, int y) { return x + y; }
+
+double batch_scale(double value, float factor) { return value * factor; }
+
+int batch_total = 0;
+void batch_touch(int n) { batch_total += n; }
+
+const char *batch_name(int i) { return i % 2 ? "odd" : "even"; }
+
+struct BatchUtil {
+  static int twice(int) ;
+};
+
+int BatchUtil::twice(int x) { return 2 * x; }
+
+%}
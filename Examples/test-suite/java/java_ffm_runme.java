@@ -0,0 +1,73 @@
+
+import java_ffm.*;
+import java.lang.reflect.*;
+
+public class java_ffm_runme {
+
+  static {
+    try {
+	System.loadLibrary("java_ffm");
+    } catch (UnsatisfiedLinkError e) {
+      System.err.println("Native code library failed to load. See the chapter on Dynamic Linking Problems in the SWIG Java documentation for help.\n" + e);
+      System.exit(1);
+    }
+  }
+
+  public static void main(String argv[]) throws Throwable {
+    try {
+      Class.forName("java.lang.foreign.Linker");
+    } catch (ClassNotFoundException e) {
+      System.out.println("Skipping java_ffm_runme as java.lang.foreign is not available");
+      return;
+    }
+
+    // Wrappers passing only primitive types are not native methods, the rest are
+    checkNative("Counter_count_set", false);
+    checkNative("Counter_count_get", false);
+    checkNative("Counter_increase", false);
+    checkNative("reset_counter", false);
+    checkNative("noop", false);
+    checkNative("counter_name", true);
+
+    Counter c = new Counter();
+    if (!c.empty())
+      throw new RuntimeException("empty failed");
+    c.setCount(10);
+    if (c.getCount() != 10)
+      throw new RuntimeException("count failed");
+    c.setScale(2.5);
+    if (c.getScale() != 2.5)
+      throw new RuntimeException("scale failed");
+    if (c.initial() != 'C')
+      throw new RuntimeException("initial failed");
+    if (c.total((short)1, (byte)2, 3.0f) != 16)
+      throw new RuntimeException("total failed");
+
+    Counter other = new Counter();
+    other.setCount(5);
+    c.increase(other);
+    if (c.getCount() != 15)
+      throw new RuntimeException("increase failed");
+
+    java_ffm.noop();
+    if (!java_ffm.counter_name(c).equals("counter"))
+      throw new RuntimeException("counter_name failed");
+    java_ffm.reset_counter(c);
+    if (c.getCount() != 0 || !c.empty())
+      throw new RuntimeException("reset_counter failed");
+
+    if (!java_ffm.counter_name(c).equals("empty counter"))
+      throw new RuntimeException("counter_name failed");
+  }
+
+  private static void checkNative(String name, boolean expected) {
+    for (Method m : java_ffmJNI.class.getDeclaredMethods()) {
+      if (m.getName().equals(name)) {
+        if (Modifier.isNative(m.getModifiers()) != expected)
+          throw new RuntimeException(name + " native method expected: " + expected);
+        return;
+      }
+    }
+    throw new RuntimeException(name + " not found");
+  }
+}
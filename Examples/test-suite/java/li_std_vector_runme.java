@@ -117,5 +117,34 @@ public class li_std_vector_runme {
     java.util.ArrayList<Boolean> bl2 = new java.util.ArrayList<Boolean>(bv);
     boolean bbb1 = bv.get(0);
     Boolean bbb2 = bv.get(0);
+
+    // bulk transfer to and from primitive arrays
+    DoubleVector dv = new DoubleVector(new double[] {1.5, 2.5, 3.5});
+    if (dv.size() != 3) throw new RuntimeException("dv test (1) failed");
+    if (dv.get(2) != 3.5) throw new RuntimeException("dv test (2) failed");
+    if (!java.util.Arrays.equals(dv.toPrimitiveArray(), new double[] {1.5, 2.5, 3.5})) throw new RuntimeException("dv test (3) failed");
+    if (!java.util.Arrays.equals(dv.toPrimitiveArray(1, 3), new double[] {2.5, 3.5})) throw new RuntimeException("dv test (4) failed");
+    if (!dv.addAll(1, new double[] {10, 20})) throw new RuntimeException("dv test (5) failed");
+    if (!java.util.Arrays.equals(dv.toPrimitiveArray(), new double[] {1.5, 10, 20, 2.5, 3.5})) throw new RuntimeException("dv test (6) failed");
+    dv.setRange(3, new double[] {0, 30, 40}, 1, 2);
+    if (!java.util.Arrays.equals(dv.toPrimitiveArray(), new double[] {1.5, 10, 20, 30, 40})) throw new RuntimeException("dv test (7) failed");
+    double[] da = new double[4];
+    dv.getRange(2, da, 1, 3);
+    if (!java.util.Arrays.equals(da, new double[] {0, 20, 30, 40})) throw new RuntimeException("dv test (8) failed");
+    if (dv.addAll(new double[0])) throw new RuntimeException("dv test (9) failed");
+    try {
+      dv.toPrimitiveArray(3, 6);
+      throw new RuntimeException("dv test (10) failed");
+    } catch (IndexOutOfBoundsException e) {
+    }
+    try {
+      dv.getRange(0, da, 2, 3);
+      throw new RuntimeException("dv test (11) failed");
+    } catch (IndexOutOfBoundsException e) {
+    }
+
+    IntVector iv = new IntVector(new int[] {1, 2, 3});
+    if (!iv.addAll(new int[] {4, 5})) throw new RuntimeException("iv test (1) failed");
+    if (!java.util.Arrays.equals(iv.toPrimitiveArray(), new int[] {1, 2, 3, 4, 5})) throw new RuntimeException("iv test (2) failed");
   }
 }
@@ -0,0 +1,26 @@
+// Test the -ffm option which calls plain C wrappers through the foreign function and memory API
+
+%module java_ffm
+
+%pragma(java) jniclassclassmodifiers="public class"
+
+%include <std_string.i>
+
+%inline %{
+#include <string>
+
+struct Counter {
+  int count;
+  double scale;
+  Counter() : count(0), scale(1.0) {}
+  void increase(const Counter *other) { count += other->count; }
+  bool empty() const { return count == 0; }
+  char initial() const { return 'C'; }
+  long long total(short s, signed char b, float f) const { return count + s + b + (long long)f; }
+};
+
+void reset_counter(Counter *counter) { counter->count = 0; }
+void noop() {}
+
+std::string counter_name(const Counter &counter) { return counter.count ? "counter" : "empty counter"; }
+%}
@@ -0,0 +1,46 @@
+var javascript_typedarrays = require("javascript_typedarrays");
+
+// typed array input
+var d = new Float64Array([1.5, 2.5, 3]);
+if (javascript_typedarrays.sum_doubles(d) != 7)
+    throw "sum_doubles is wrong";
+
+// the function works on the memory of the array
+javascript_typedarrays.scale_doubles(d, 2);
+if (d[0] != 3 || d[1] != 5 || d[2] != 6)
+    throw "scale_doubles did not modify the array";
+
+// typed array with an offset into its ArrayBuffer
+if (javascript_typedarrays.sum_doubles(d.subarray(1)) != 11)
+    throw "sum_doubles of a subarray is wrong";
+
+// ArrayBuffer input
+var ints = new Int32Array([1, 2, 3, 4]);
+if (javascript_typedarrays.sum_ints(ints.buffer) != 10)
+    throw "sum_ints of an ArrayBuffer is wrong";
+
+// wrong element type
+var thrown = false;
+try {
+    javascript_typedarrays.sum_ints(new Float32Array(4));
+} catch (e) {
+    thrown = true;
+    if (e.message.indexOf("Int32Array") < 0)
+        throw "unexpected error message: " + e.message;
+}
+if (!thrown)
+    throw "sum_ints accepted a Float32Array";
+
+// std::vector return
+var f = javascript_typedarrays.make_floats(4);
+if (!(f instanceof Float32Array))
+    throw "make_floats did not return a Float32Array";
+if (f.length != 4 || f[0] != 0 || f[3] != 1.5)
+    throw "make_floats is wrong";
+
+// empty std::vector return
+var e = javascript_typedarrays.empty_bytes();
+if (!(e instanceof Uint8Array))
+    throw "empty_bytes did not return a Uint8Array";
+if (e.length != 0 || e.buffer.byteLength != 0)
+    throw "empty_bytes is not empty";
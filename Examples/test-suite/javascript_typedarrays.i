@@ -0,0 +1,41 @@
+%module javascript_typedarrays
+
+%include <typedarrays.i>
+
+%{
+#include <vector>
+%}
+
+%apply (double *DATA, size_t LENGTH) { (double *values, size_t count) };
+
+%inline %{
+double sum_doubles(const double *DATA, size_t LENGTH) {
+  double sum = 0;
+  for (size_t i = 0; i < LENGTH; ++i)
+    sum += DATA[i];
+  return sum;
+}
+
+void scale_doubles(double *values, size_t count, double factor) {
+  for (size_t i = 0; i < count; ++i)
+    values[i] *= factor;
+}
+
+int sum_ints(const int *DATA, size_t LENGTH) {
+  int sum = 0;
+  for (size_t i = 0; i < LENGTH; ++i)
+    sum += DATA[i];
+  return sum;
+}
+
+std::vector<float> make_floats(size_t count) {
+  std::vector<float> v;
+  for (size_t i = 0; i < count; ++i)
+    v.push_back(i * 0.5f);
+  return v;
+}
+
+std::vector<unsigned char> empty_bytes() {
+  return std::vector<unsigned char>();
+}
+%}
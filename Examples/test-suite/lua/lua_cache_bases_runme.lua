@@ -0,0 +1,38 @@
+require("import")	-- the import fn
+import("lua_cache_bases")	-- import lib
+
+local t = lua_cache_bases
+local base = t.Base()
+local middle = t.Middle()
+local derived = t.Derived()
+
+-- nothing is cached until a member is used
+assert(rawget(getmetatable(derived)[".fn"], "base_only") == nil)
+assert(derived:base_only() == "Base::base_only")
+assert(rawget(getmetatable(derived)[".fn"], "base_only") ~= nil)
+assert(derived:base_only() == "Base::base_only")
+
+-- the nearest base class wins
+assert(derived:name() == "Middle")
+assert(derived:name() == "Middle")
+assert(middle:name() == "Middle")
+assert(base:name() == "Base")
+
+-- attributes
+assert(derived.value == 1)
+derived.value = 5
+assert(derived.value == 5)
+assert(rawget(getmetatable(derived)[".get"], "value") ~= nil)
+assert(rawget(getmetatable(derived)[".set"], "value") ~= nil)
+assert(base.value == 1)
+
+-- __setitem takes precedence over setters in base classes
+local setitem = t.SetItem()
+setitem.value = 10
+assert(setitem.setitem_value == 10)
+assert(setitem.value == 1)
+assert(rawget(getmetatable(setitem)[".set"], "value") == nil)
+
+-- unknown members
+assert(derived.unknown == nil)
+assert(not pcall(function() derived.unknown = 1 end))
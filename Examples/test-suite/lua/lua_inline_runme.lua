@@ -0,0 +1,37 @@
+require("import")	-- the import fn
+import("lua_inline")	-- import lib
+
+local t = lua_inline
+
+-- catch "undefined" global variables
+local env = _ENV -- Lua 5.2
+if not env then env = getfenv () end -- Lua 5.1
+setmetatable(env, {__index=function (t,i) error("undefined global variable `"..i.."'",2) end})
+
+local a = t.make_vec3(1, 2, 3)
+assert(a.x == 1 and a.y == 2 and a.z == 3)
+assert(getmetatable(a) == getmetatable(t.Vec3()))
+
+-- inline values are passed by value, pointer and reference
+local b = t.add(a, t.make_vec3(10, 20, 30))
+assert(b.x == 11 and b.y == 22 and b.z == 33)
+assert(a:dot(t.make_vec3(1, 1, 1)) == 6)
+t.scale(a, 2)
+assert(a.x == 2 and a.y == 4 and a.z == 6)
+a.x = 5
+assert(a.x == 5)
+
+-- values returned by methods are copies
+local p = t.Particle()
+p.position = a
+local pos = p:get_position()
+pos.x = 100
+assert(p.position.x == 5)
+
+-- inline values are freed by the garbage collector
+for i = 1, 10000 do
+  local v = t.make_vec3(i, i, i)
+  assert(v.x == i)
+end
+collectgarbage()
+assert(a.x == 5 and b.z == 33)
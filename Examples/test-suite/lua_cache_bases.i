@@ -0,0 +1,30 @@
+%module lua_cache_bases
+
+// Tested with the -cache-bases option
+
+%inline %{
+class Base {
+public:
+  int value;
+  Base() : value(1) {}
+  virtual ~Base() {}
+  const char* name() const { return "Base"; }
+  const char* base_only() const { return "Base::base_only"; }
+};
+
+class Middle : public Base {
+public:
+  const char* name() const { return "Middle"; }
+};
+
+class Derived : public Middle {
+};
+
+/* __setitem is used for assignments before searching the base classes */
+class SetItem : public Base {
+public:
+  int setitem_value;
+  SetItem() : setitem_value(0) {}
+  void __setitem(const char *name, int v) { setitem_value = v; }
+};
+%}
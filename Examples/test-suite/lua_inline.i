@@ -0,0 +1,30 @@
+%module lua_inline
+
+%include <lua_inline.i>
+%lua_inline(Vec3)
+
+%inline %{
+struct Vec3 {
+  double x, y, z;
+  double dot(const Vec3 &other) const { return x*other.x + y*other.y + z*other.z; }
+};
+
+Vec3 make_vec3(double x, double y, double z) {
+  Vec3 v;
+  v.x = x; v.y = y; v.z = z;
+  return v;
+}
+
+Vec3 add(Vec3 a, const Vec3 *b) {
+  return make_vec3(a.x + b->x, a.y + b->y, a.z + b->z);
+}
+
+void scale(Vec3 &v, double s) {
+  v.x *= s; v.y *= s; v.z *= s;
+}
+
+struct Particle {
+  Vec3 position;
+  Vec3 get_position() const { return position; }
+};
+%}
@@ -3,13 +3,30 @@
 # Workaround seg fault occurring during interpreter cleanup/exit in version 3.1 and 3.2, seems okay in 3.6
 if (compare_versions(version(), "3.3", ">="))
   imports_b;
-  imports_a;
 
+  # base class A is in module imports_a, which is not loaded yet
   x = imports_b.B();
+  x.bye();
+
+  imports_a;
+
+  # inherited from a base class in another module, through A_Intermediate
   x.hello();
+  x.bye();
 
   a = imports_a.A();
 
+  # overridden methods
+  assert(a.member_virtual_test(10) == 10);
+  assert(x.member_virtual_test(10) == 11);
+  assert(a.global_virtual_test(1) == 1);
+  assert(x.global_virtual_test(1) == 2);
+
+  # inherited method of a class in the other module
+  i = imports_a.A_Intermediate();
+  i.hello();
+  assert(i.member_virtual_test(10) == 10);
+
   c = imports_b.C();
   a1 = c.get_a(c);
   a2 = c.get_a_type(c);
@@ -19,4 +36,3 @@ if (compare_versions(version(), "3.3", ">="))
   assert(swig_this(a1)==swig_this(a2));
   assert(strcmp(swig_type(a1),swig_type(a2)));
 endif
-
@@ -50,3 +50,9 @@ mii[1] = 2
 
 if mii[1] != 2:
     raise RuntimeError
+
+mii[3] = 4
+if list(mii) != [1, 3]:
+    raise RuntimeError
+if sorted(mii.itervalues()) != [2, 4]:
+    raise RuntimeError
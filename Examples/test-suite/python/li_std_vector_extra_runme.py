@@ -173,3 +173,12 @@ if extractConstShort(vcs[0]) != 111:
 
 if extractConstShort(vcs[1]) != 222:
     raise RuntimeError
+
+# iterators keep the vector alive
+bv = BoolVector((True, False, True))
+it = iter(bv)
+del bv
+if list(it) != [True, False, True]:
+    raise RuntimeError
+if list(it) != []:
+    raise RuntimeError
@@ -0,0 +1,100 @@
+import python_dirvtable
+
+
+class Derived(python_dirvtable.Base):
+
+    def value(self):
+        return 2
+
+    def add(self, i):
+        return i + 2
+
+
+class MoreDerived(Derived):
+    pass
+
+
+def check(b, value, add):
+    if python_dirvtable.call_value(b) != value:
+        raise RuntimeError("value %d, expected %d" % (python_dirvtable.call_value(b), value))
+    if python_dirvtable.call_add(b, 10) != add:
+        raise RuntimeError("add %d, expected %d" % (python_dirvtable.call_add(b, 10), add))
+
+d = Derived()
+m = MoreDerived()
+for i in range(3):
+    check(python_dirvtable.Base(), 1, 11)
+    check(d, 2, 12)
+    check(Derived(), 2, 12)
+    check(m, 2, 12)
+
+# Changing a class is seen by the class and its subclasses
+# (the classes cannot be changed with -builtin)
+if python_dirvtable.is_python_builtin():
+    value = 2
+else:
+    value = 3
+    Derived.value = lambda self: 3
+    check(d, 3, 12)
+    check(m, 3, 12)
+    MoreDerived.add = lambda self, i: i + 4
+    check(d, 3, 12)
+    check(m, 3, 14)
+    del MoreDerived.add
+    check(m, 3, 12)
+
+# Instance attributes shadow the class methods
+d.value = lambda: 5
+check(d, 5, 12)
+check(Derived(), value, 12)
+del d.value
+check(d, value, 12)
+
+# Methods that are not plain functions
+class Static(python_dirvtable.Base):
+
+    @staticmethod
+    def value():
+        return 6
+
+    @classmethod
+    def add(cls, i):
+        return i + 6
+
+check(Static(), 6, 16)
+
+# Lookup redirected by __getattribute__
+class Redirected(Derived):
+
+    def __getattribute__(self, name):
+        if name == "value":
+            return lambda: 7
+        return Derived.__getattribute__(self, name)
+
+check(Redirected(), 7, 12)
+
+# Changing the class of an instance
+d.__class__ = MoreDerived
+check(d, value, 12)
+
+# The methods of deleted classes are released once other classes are used
+import gc
+import weakref
+
+def make_classes(count):
+    classes = []
+    for i in range(count):
+        def value(self, i=i):
+            return i
+        classes.append(type("Temporary%d" % i, (python_dirvtable.Base,), {"value": value}))
+        check(classes[-1](), i, 11)
+    return classes
+
+classes = make_classes(100)
+refs = [weakref.ref(c.__dict__["value"]) for c in classes]
+del classes
+gc.collect()
+others = make_classes(200)
+alive = len([r for r in refs if r() is not None])
+if alive > 10:
+    raise RuntimeError("%d methods of deleted classes still referenced" % alive)
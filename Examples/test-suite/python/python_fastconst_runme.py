@@ -0,0 +1,44 @@
+import sys
+import python_fastconst
+
+constants = ["FC_INT", "FC_NEGATIVE", "FC_LONG", "FC_DOUBLE", "RED", "GREEN", "BLUE", "ANONYMOUS_VALUE", "FC_CONSTANT"]
+
+if sys.version_info >= (3, 7, 0) and not python_fastconst.is_python_builtin():
+    for name in constants + ["Color"]:
+        if name in vars(python_fastconst):
+            raise RuntimeError("%s created on import" % name)
+        if name not in dir(python_fastconst):
+            raise RuntimeError("%s not in dir()" % name)
+
+if python_fastconst.FC_INT != 42 or python_fastconst.FC_NEGATIVE != -7 or python_fastconst.FC_LONG != 1234567:
+    raise RuntimeError("integer constants")
+if python_fastconst.FC_DOUBLE != 2.5 or python_fastconst.FC_STRING != "text":
+    raise RuntimeError("other constants")
+if python_fastconst.RED != 0 or python_fastconst.GREEN != 10 or python_fastconst.BLUE != 11:
+    raise RuntimeError("enum values")
+if python_fastconst.ANONYMOUS_VALUE != 3 or python_fastconst.FC_CONSTANT != 11:
+    raise RuntimeError("anonymous enum and %constant")
+if python_fastconst.Holder.SMALL != 1 or python_fastconst.Holder.LARGE != 2 or python_fastconst.Holder.LIMIT != 100:
+    raise RuntimeError("class constants")
+
+try:
+    python_fastconst.NOT_A_CONSTANT
+    raise RuntimeError("NOT_A_CONSTANT found")
+except AttributeError:
+    pass
+
+if not python_fastconst.is_python_builtin():
+    Color = python_fastconst.Color
+    if Color.RED != 0 or Color.GREEN != 10 or Color.BLUE != 11:
+        raise RuntimeError("enum class values")
+    if python_fastconst.color_value(Color.BLUE) != 11:
+        raise RuntimeError("enum class member as argument")
+    if sys.version_info >= (3, 4, 0):
+        if [c.name for c in Color] != ["RED", "GREEN", "BLUE"]:
+            raise RuntimeError("enum class members")
+        if Color(10) is not Color.GREEN:
+            raise RuntimeError("enum class lookup")
+
+from python_fastconst import *
+if FC_INT != 42 or BLUE != 11:
+    raise RuntimeError("import *")
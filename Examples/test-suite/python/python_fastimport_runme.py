@@ -0,0 +1,87 @@
+import sys
+import threading
+import python_fastimport
+
+classes = ["Base", "Derived", "Amount", "Error", "Shared"]
+
+if sys.version_info >= (3, 7, 0) and not python_fastimport.is_python_builtin():
+    for name in classes:
+        if name in vars(python_fastimport):
+            raise RuntimeError("%s created on import" % name)
+        if name not in dir(python_fastimport):
+            raise RuntimeError("%s not in dir()" % name)
+
+# Returned objects create their proxy class
+b = python_fastimport.make_derived()
+if type(b).__name__ != "Base" or b.get_id() != 2:
+    raise RuntimeError("make_derived")
+d = python_fastimport.make_derived_typedef()
+if type(d).__name__ != "Derived" or d.get_id() != 2:
+    raise RuntimeError("make_derived_typedef")
+if not isinstance(d, python_fastimport.Base):
+    raise RuntimeError("Derived base class")
+if python_fastimport.Derived.twice(3) != 6:
+    raise RuntimeError("static method")
+
+# %pythonappend code creating a class
+if not python_fastimport.is_python_builtin():
+    a = python_fastimport.amount_from_id(b)
+    if type(a).__name__ != "Amount" or a.value != 2:
+        raise RuntimeError("amount_from_id")
+
+# Implicit conversion creates the proxy class
+if python_fastimport.amount_value(5) != 5:
+    raise RuntimeError("implicit conversion")
+
+# Python code in the proxy module must use _swig_lazy_class for classes not created yet
+if sys.version_info >= (3, 7, 0) and not python_fastimport.is_python_builtin():
+    try:
+        python_fastimport.error_class_by_name()
+        raise RuntimeError("Error found before it is created")
+    except NameError:
+        pass
+    if python_fastimport.error_class() is not python_fastimport.Error:
+        raise RuntimeError("error_class")
+
+# Thrown exceptions create their proxy class
+if not python_fastimport.is_python_builtin():
+    try:
+        python_fastimport.throw_error(3)
+        raise RuntimeError("no exception")
+    except python_fastimport.Error as e:
+        if e.code != 3:
+            raise RuntimeError("exception code")
+
+try:
+    python_fastimport.NotAClass
+    raise RuntimeError("NotAClass found")
+except AttributeError:
+    pass
+
+# Threads creating the same class wait for each other
+if hasattr(sys, "setswitchinterval"):
+    sys.setswitchinterval(1e-6)
+errors = []
+start = threading.Barrier(8) if hasattr(threading, "Barrier") else None
+def use_shared(i):
+    try:
+        if start:
+            start.wait()
+        if i % 2:
+            if python_fastimport.make_shared_instance().value != 7:
+                errors.append("make_shared_instance")
+        elif python_fastimport.Shared().value != 7:
+            errors.append("Shared")
+    except Exception as e:
+        errors.append(repr(e))
+threads = [threading.Thread(target=use_shared, args=(i,)) for i in range(8)]
+for t in threads:
+    t.start()
+for t in threads:
+    t.join()
+if errors:
+    raise RuntimeError("threads: %s" % errors)
+
+for name in classes[:3]:
+    if name not in vars(python_fastimport):
+        raise RuntimeError("%s not created" % name)
@@ -0,0 +1,22 @@
+/* Director methods resolved once per Python type with -dirvtable */
+
+%module(directors="1") python_dirvtable
+
+%feature("director") Base;
+
+%inline %{
+struct Base {
+  virtual ~Base() {}
+  virtual int value() { return 1; }
+  virtual int add(int i) { return i + 1; }
+};
+
+int call_value(Base *b) { return b->value(); }
+int call_add(Base *b, int i) { return b->add(i); }
+
+#ifdef SWIGPYTHON_BUILTIN
+bool is_python_builtin() { return true; }
+#else
+bool is_python_builtin() { return false; }
+#endif
+%}
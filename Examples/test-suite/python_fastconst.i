@@ -0,0 +1,31 @@
+/* Constants and enum classes created on first use with -fastconst -intenum */
+
+%module python_fastconst
+
+%inline %{
+#define FC_INT 42
+#define FC_NEGATIVE -7
+#define FC_LONG 1234567L
+#define FC_DOUBLE 2.5
+#define FC_STRING "text"
+
+enum Color { RED, GREEN = 10, BLUE };
+enum { ANONYMOUS_VALUE = 3 };
+
+struct Holder {
+  enum Size { SMALL = 1, LARGE = 2 };
+  static const int LIMIT = 100;
+};
+
+int color_value(Color c) { return (int)c; }
+%}
+
+%constant int FC_CONSTANT = 11;
+
+%inline %{
+#ifdef SWIGPYTHON_BUILTIN
+bool is_python_builtin() { return true; }
+#else
+bool is_python_builtin() { return false; }
+#endif
+%}
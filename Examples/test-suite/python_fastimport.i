@@ -0,0 +1,68 @@
+/* Proxy classes created on first use with -fastimport */
+
+%module python_fastimport
+
+%feature("implicitconv") Amount;
+%catches(Error) throw_error;
+
+%inline %{
+struct Base {
+  int id;
+  Base() : id(1) {}
+  virtual ~Base() {}
+  int get_id() const { return id; }
+};
+
+struct Derived : Base {
+  Derived() { id = 2; }
+  static int twice(int i) { return 2*i; }
+};
+
+typedef Derived DerivedTypedef;
+
+struct Amount {
+  int value;
+  Amount(int value) : value(value) {}
+};
+
+struct Error {
+  int code;
+  Error(int code) : code(code) {}
+};
+
+struct Shared {
+  int value;
+  Shared() : value(7) {}
+};
+
+Base *make_derived() { return new Derived(); }
+Shared *make_shared_instance() { static Shared s; return &s; }
+DerivedTypedef *make_derived_typedef() { return new Derived(); }
+int amount_value(const Amount &a) { return a.value; }
+void throw_error(int code) { throw Error(code); }
+%}
+
+%pythonappend amount_from_id %{
+    val = _swig_lazy_class("Amount")(val)
+%}
+
+%inline %{
+int amount_from_id(const Base &b) { return b.id; }
+%}
+
+/* Global names in Python code are looked up without the module __getattr__ */
+%pythoncode %{
+def error_class_by_name():
+    return Error
+
+def error_class():
+    return _swig_lazy_class("Error")
+%}
+
+%inline %{
+#ifdef SWIGPYTHON_BUILTIN
+bool is_python_builtin() { return true; }
+#else
+bool is_python_builtin() { return false; }
+#endif
+%}
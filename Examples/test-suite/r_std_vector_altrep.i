@@ -0,0 +1,42 @@
+%module r_std_vector_altrep
+
+// Return std::vector<double> and std::vector<int> as ALTREP vectors
+%begin %{
+#define SWIG_R_ALTREP_VECTORS
+%}
+
+%include "std_vector.i"
+
+%template(DoubleVector) std::vector<double>;
+%template(IntVector) std::vector<int>;
+
+%inline %{
+std::vector<double> double_range(int n) {
+  std::vector<double> v;
+  for (int i = 0; i < n; ++i)
+    v.push_back(i * 0.5);
+  return v;
+}
+
+std::vector<int> int_range(int n) {
+  std::vector<int> v;
+  for (int i = 0; i < n; ++i)
+    v.push_back(i);
+  return v;
+}
+
+std::vector<double> echo_doubles(const std::vector<double> &v) {
+  return v;
+}
+
+std::vector<int> echo_ints(const std::vector<int> &v) {
+  return v;
+}
+
+double sum_doubles(const std::vector<double> &v) {
+  double sum = 0;
+  for (size_t i = 0; i < v.size(); ++i)
+    sum += v[i];
+  return sum;
+}
+%}
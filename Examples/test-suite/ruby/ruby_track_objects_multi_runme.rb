@@ -0,0 +1,36 @@
+#!/usr/bin/env ruby
+#
+# Tests that the object trackings and $SWIG_TRACKINGS_STATS
+# are shared between modules
+#
+
+require 'swig_assert'
+
+require 'ruby_track_objects_multi_a'
+require 'ruby_track_objects_multi_b'
+
+stats = $SWIG_TRACKINGS_STATS
+swig_assert("stats.is_a?(Hash)", binding)
+swig_assert_equal("stats[:count]", "$SWIG_TRACKINGS_COUNT", binding)
+swig_assert("stats[:shards] > 0", binding)
+swig_assert("stats[:max_shard_count] <= stats[:count]", binding)
+
+count = $SWIG_TRACKINGS_COUNT
+
+widgets = []
+100.times { |i| widgets << Ruby_track_objects_multi_a::Widget.new(i) }
+
+stats = $SWIG_TRACKINGS_STATS
+swig_assert_equal("stats[:count]", "count + 100", binding)
+swig_assert_equal("stats[:count]", "$SWIG_TRACKINGS_COUNT", binding)
+swig_assert("stats[:max_shard_count] > 0", binding)
+if stats[:shards] > 1
+  # the trackings are spread across the tables
+  swig_assert("stats[:max_shard_count] < 100", binding)
+end
+
+# the same Ruby object is returned by both modules
+widgets.each do |w|
+  swig_assert("Ruby_track_objects_multi_a::same_widget_a(w).equal?(w)", binding)
+  swig_assert("Ruby_track_objects_multi_b::same_widget_b(w).equal?(w)", binding)
+end
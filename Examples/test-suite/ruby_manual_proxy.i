@@ -46,7 +46,7 @@ static VALUE svn_fs_swig_rb_close(VALUE self) {
     svn_swig_rb_raise_svn_fs_already_close();
   }
 
-  DATA_PTR(self) = NULL;
+  SWIG_ClearObject(self);
 
   return Qnil;
 }
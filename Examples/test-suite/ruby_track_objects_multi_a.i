@@ -0,0 +1,18 @@
+/* Tests that the object trackings are shared between modules.
+   See also ruby_track_objects_multi_b.i */
+
+%module ruby_track_objects_multi_a
+
+%trackobjects Widget;
+
+%inline %{
+class Widget {
+public:
+  Widget(int id) : id(id) {}
+  int id;
+};
+
+Widget *same_widget_a(Widget *w) {
+  return w;
+}
+%}
@@ -0,0 +1,13 @@
+%module ruby_track_objects_multi_b
+
+%import "ruby_track_objects_multi_a.i"
+
+%{
+class Widget;
+%}
+
+%inline %{
+Widget *same_widget_b(Widget *w) {
+  return w;
+}
+%}
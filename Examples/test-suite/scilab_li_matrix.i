@@ -154,6 +154,35 @@ template<typename T> void inoutMatrixDims(T *matrix, int nbRow, int nbCol,
 %instantiate_matrix_template_functions(CharPtr, char *);
 %instantiate_matrix_template_functions(Bool, bool);
 
+// double matrices passed without copy and filled in place
+
+%apply (const double *IN, int IN_ROWCOUNT, int IN_COLCOUNT) { (const double *matrix, int nbRow, int nbCol) }
+%apply (double *OUT, int OUT_ROWCOUNT, int OUT_COLCOUNT) { (double *matrixRes, int nbRowRes, int nbColRes) }
+%apply (double *OUT, int OUT_SIZE) { (double *matrixRes, int sizeRes) }
+
+%inline %{
+double inConstDoubleMatrixDims(const double *matrix, int nbRow, int nbCol) {
+  double sum = 0;
+  int i;
+  for (i = 0; i < nbRow * nbCol; i++)
+    sum += matrix[i];
+  return sum;
+}
+
+void fillDoubleMatrixDims(double *matrixRes, int nbRowRes, int nbColRes) {
+  int i;
+  for (i = 0; i < nbRowRes * nbColRes; i++)
+    matrixRes[i] = i;
+}
+
+int fillDoubleMatrixSize(double *matrixRes, int sizeRes) {
+  int i;
+  for (i = 0; i < sizeRes; i++)
+    matrixRes[i] = i;
+  return sizeRes;
+}
+%}
+
 
 
 
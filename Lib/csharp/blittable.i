@@ -0,0 +1,151 @@
+/* -----------------------------------------------------------------------------
+ * blittable.i
+ *
+ * Typemaps for wrapping POD structs as C# value types (blittable structs).
+ *
+ * By default a C/C++ struct is wrapped by a C# proxy class holding a pointer
+ * to memory allocated on the C/C++ heap and each field is accessed through a
+ * P/Invoke call. The %csblittable macro instead generates a C# struct with
+ * StructLayout(LayoutKind.Sequential) and the same field layout as the C struct.
+ * The struct is passed by value or by reference through P/Invoke and as it is
+ * blittable, no marshalling copies are made. Arrays of the struct are pinned by
+ * the P/Invoke marshaller and passed directly to C/C++ using the INPUT, OUTPUT
+ * and INOUT typemaps.
+ *
+ * The struct must only contain member variables of fixed size primitive types,
+ * enums, pointers or other blittable structs. C long, bool and char are not
+ * supported as their C# equivalents have a different size.
+ *
+ * Example usage:
+ *
+ *   %include "blittable.i"
+ *   %csblittable(Point)
+ *   %apply Point INPUT[] { const Point *points }
+ *
+ *   struct Point { double x, y; };
+ *   Point centroid(const Point *points, int count);
+ *   void translate(Point &p, double dx, double dy);
+ *
+ * results in the following C# usage:
+ *
+ *   Point[] points = new Point[1000];
+ *   Point c = example.centroid(points, points.Length);
+ *   example.translate(ref c, 1.0, 2.0);
+ *
+ * Null pointers cannot be passed to TYPE * or TYPE & parameters as they are
+ * mapped to C# ref parameters. Pointers returned from C/C++ are returned as
+ * global::System.IntPtr.
+ * ----------------------------------------------------------------------------- */
+
+/* The value returned by a wrapper when a C# exception is pending before the result is set */
+#define %_csblittable_str(X...) #X
+#define %_csblittable_null_fragment(TYPE...) %_csblittable_str(SWIG_csblittable_null_ ## #@TYPE)
+#ifdef __cplusplus
+#define %_csblittable_null(TYPE...) "SwigValueInit< TYPE >()"
+%define %_csblittable_null_decl(TYPE...)
+%fragment(%_csblittable_null_fragment(TYPE), "header") %{%}
+%enddef
+#else
+#define %_csblittable_null(TYPE...) %_csblittable_null_fragment(TYPE)
+%define %_csblittable_null_decl(TYPE...)
+%fragment(%_csblittable_null_fragment(TYPE), "header") %{
+static TYPE SWIG_csblittable_null_ ## #@TYPE;
+%}
+%enddef
+#endif
+
+%define %csblittable(TYPE...)
+
+%feature("cs:blittable") TYPE;
+%_csblittable_null_decl(TYPE)
+%naturalvar TYPE;
+%typemap(csclassmodifiers) TYPE "public struct"
+
+// pass by value
+
+%typemap(ctype)  TYPE "TYPE"
+%typemap(imtype) TYPE "$csclassname"
+%typemap(cstype) TYPE "$csclassname"
+%typemap(csin)   TYPE "$csinput"
+%typemap(in)     TYPE %{ $1 = $input; %}
+%typemap(out, null=%_csblittable_null(TYPE), fragment=%_csblittable_null_fragment(TYPE)) TYPE %{ $result = $1; %}
+%typemap(csout, excode=SWIGEXCODE) TYPE {
+    $csclassname ret = $imcall;$excode
+    return ret;
+  }
+%typemap(directorin) TYPE "$input = $1;"
+%typemap(directorout) TYPE %{ $result = $input; %}
+%typemap(csdirectorin) TYPE "$iminput"
+%typemap(csdirectorout) TYPE "$cscall"
+%typemap(csvarin, excode=SWIGEXCODE2) TYPE %{
+    set {
+      $imcall;$excode
+    } %}
+%typemap(csvarout, excode=SWIGEXCODE2) TYPE %{
+    get {
+      $csclassname ret = $imcall;$excode
+      return ret;
+    } %}
+
+// const reference inputs are passed by reference without copying, outputs are copied
+
+%typemap(ctype, out="TYPE") const TYPE & "TYPE *"
+%typemap(imtype, out="$csclassname") const TYPE & "ref $csclassname"
+%typemap(cstype) const TYPE & "$csclassname"
+%typemap(csin)   const TYPE & "ref $csinput"
+%typemap(in)     const TYPE & %{ $1 = $input; %}
+%typemap(out, null=%_csblittable_null(TYPE), fragment=%_csblittable_null_fragment(TYPE)) const TYPE & %{ $result = *$1; %}
+%typemap(csout, excode=SWIGEXCODE) const TYPE & {
+    $csclassname ret = $imcall;$excode
+    return ret;
+  }
+%typemap(csvarin, excode=SWIGEXCODE2) const TYPE & %{
+    set {
+      $imcall;$excode
+    } %}
+%typemap(csvarout, excode=SWIGEXCODE2) const TYPE & %{
+    get {
+      $csclassname ret = $imcall;$excode
+      return ret;
+    } %}
+
+// pointers and non-const references are C# ref parameters
+
+%typemap(ctype)  TYPE *, const TYPE *, TYPE & "TYPE *"
+%typemap(imtype, out="global::System.IntPtr") TYPE *, const TYPE *, TYPE & "ref $csclassname"
+%typemap(cstype, out="global::System.IntPtr") TYPE *, const TYPE *, TYPE & "ref $csclassname"
+%typemap(csin)   TYPE *, const TYPE *, TYPE & "ref $csinput"
+%typemap(in)     TYPE *, const TYPE *, TYPE & %{ $1 = $input; %}
+%typemap(out)    TYPE *, const TYPE *, TYPE & %{ $result = (TYPE *)$1; %}
+%typemap(csout, excode=SWIGEXCODE) TYPE *, const TYPE *, TYPE & {
+    global::System.IntPtr ret = $imcall;$excode
+    return ret;
+  }
+
+// arrays are pinned by the P/Invoke marshaller, no copies are made
+
+%typemap(ctype)   TYPE INPUT[] "TYPE *"
+%typemap(cstype)  TYPE INPUT[] "$csclassname[]"
+%typemap(imtype, inattributes="[global::System.Runtime.InteropServices.In]") TYPE INPUT[] "$csclassname[]"
+%typemap(csin)    TYPE INPUT[] "$csinput"
+%typemap(in)      TYPE INPUT[] "$1 = $input;"
+%typemap(freearg) TYPE INPUT[] ""
+%typemap(argout)  TYPE INPUT[] ""
+
+%typemap(ctype)   TYPE OUTPUT[] "TYPE *"
+%typemap(cstype)  TYPE OUTPUT[] "$csclassname[]"
+%typemap(imtype, inattributes="[global::System.Runtime.InteropServices.Out]") TYPE OUTPUT[] "$csclassname[]"
+%typemap(csin)    TYPE OUTPUT[] "$csinput"
+%typemap(in)      TYPE OUTPUT[] "$1 = $input;"
+%typemap(freearg) TYPE OUTPUT[] ""
+%typemap(argout)  TYPE OUTPUT[] ""
+
+%typemap(ctype)   TYPE INOUT[] "TYPE *"
+%typemap(cstype)  TYPE INOUT[] "$csclassname[]"
+%typemap(imtype, inattributes="[global::System.Runtime.InteropServices.In, global::System.Runtime.InteropServices.Out]") TYPE INOUT[] "$csclassname[]"
+%typemap(csin)    TYPE INOUT[] "$csinput"
+%typemap(in)      TYPE INOUT[] "$1 = $input;"
+%typemap(freearg) TYPE INOUT[] ""
+%typemap(argout)  TYPE INOUT[] ""
+
+%enddef
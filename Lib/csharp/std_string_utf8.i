@@ -0,0 +1,181 @@
+/* -----------------------------------------------------------------------------
+ * std_string_utf8.i
+ *
+ * Typemaps for std::string and const std::string & using UTF-8 marshalling
+ * without the SWIGStringHelper callback.
+ *
+ * The default std::string typemaps in std_string.i return strings by calling
+ * back into C# from the wrapper to create the managed string. These typemaps
+ * instead return a pointer and length to the UTF-8 data and the string is
+ * created on the C# side once the wrapper has returned, so only one transition
+ * and no intermediate copies are made. Strings are passed into C++ as UTF-8
+ * using the LPUTF8Str marshaller.
+ *
+ * std::vector<std::string> return values are also returned in one transition
+ * as an array of pointer and length pairs and are converted into a C# string[].
+ *
+ * Strings returned by value are moved and strings returned by reference are
+ * copied into a thread local buffer until the C# side has copied them, as a
+ * reference may refer to a temporary such as a converted input string. Only
+ * member and global variable getters return the variable's data without a
+ * copy, using the varout typemaps. The generated C++ code requires C++11. The
+ * typemaps are not suitable for director methods returning strings.
+ *
+ * Example usage:
+ *
+ *   %include "std_string_utf8.i"
+ *
+ *   std::string name(const std::string &s);
+ *   std::vector<std::string> names();
+ *
+ * results in the following C# methods:
+ *
+ *   public static string name(string s);
+ *   public static string[] names();
+ * ----------------------------------------------------------------------------- */
+
+%include <std_string.i>
+
+%fragment("SWIG_CSharpUTF8String", "header") %{
+#include <string>
+#include <vector>
+
+typedef struct {
+  const char *data;
+  int length;
+} SWIG_CSharpUTF8String;
+
+typedef struct {
+  const SWIG_CSharpUTF8String *strings;
+  int count;
+} SWIG_CSharpUTF8StringArray;
+
+SWIGINTERN SWIG_CSharpUTF8String SWIG_CSharpUTF8StringFrom(const std::string &s) {
+  SWIG_CSharpUTF8String result;
+  result.data = s.data();
+  result.length = (int)s.size();
+  return result;
+}
+
+SWIGINTERN std::string &SWIG_CSharpUTF8StringBuffer() {
+  static thread_local std::string buffer;
+  return buffer;
+}
+
+SWIGINTERN SWIG_CSharpUTF8StringArray SWIG_CSharpUTF8StringArrayFrom(const std::vector<std::string> &v) {
+  static thread_local std::vector<SWIG_CSharpUTF8String> views;
+  views.resize(v.size());
+  for (size_t i = 0; i < v.size(); ++i)
+    views[i] = SWIG_CSharpUTF8StringFrom(v[i]);
+  SWIG_CSharpUTF8StringArray result;
+  result.strings = views.empty() ? 0 : &views[0];
+  result.count = (int)views.size();
+  return result;
+}
+
+SWIGINTERN std::vector<std::string> &SWIG_CSharpUTF8StringArrayBuffer() {
+  static thread_local std::vector<std::string> buffer;
+  return buffer;
+}
+%}
+
+%pragma(csharp) imclasscode=%{
+  [global::System.Runtime.InteropServices.StructLayout(global::System.Runtime.InteropServices.LayoutKind.Sequential)]
+  public struct SWIGUTF8String {
+    public global::System.IntPtr data;
+    public int length;
+
+    public static string Create(global::System.IntPtr data, int length) {
+      if (length == 0)
+        return "";
+#if NETCOREAPP || NETSTANDARD2_1_OR_GREATER
+      return global::System.Runtime.InteropServices.Marshal.PtrToStringUTF8(data, length);
+#else
+      byte[] bytes = new byte[length];
+      global::System.Runtime.InteropServices.Marshal.Copy(data, bytes, 0, length);
+      return global::System.Text.Encoding.UTF8.GetString(bytes);
+#endif
+    }
+
+    public override string ToString() {
+      return Create(data, length);
+    }
+  }
+
+  [global::System.Runtime.InteropServices.StructLayout(global::System.Runtime.InteropServices.LayoutKind.Sequential)]
+  public struct SWIGUTF8StringArray {
+    public global::System.IntPtr strings;
+    public int count;
+
+    public string[] ToArray() {
+      // each element is a pointer followed by an int padded to the pointer size
+      int size = 2 * global::System.IntPtr.Size;
+      string[] result = new string[count];
+      for (int i = 0; i < count; ++i) {
+        global::System.IntPtr data = global::System.Runtime.InteropServices.Marshal.ReadIntPtr(strings, i * size);
+        int length = global::System.Runtime.InteropServices.Marshal.ReadInt32(strings, i * size + global::System.IntPtr.Size);
+        result[i] = SWIGUTF8String.Create(data, length);
+      }
+      return result;
+    }
+  }
+%}
+
+namespace std {
+
+// string
+
+%typemap(ctype, out="SWIG_CSharpUTF8String") string "char *"
+%typemap(imtype, out="$imclassname.SWIGUTF8String", inattributes="[global::System.Runtime.InteropServices.MarshalAs(global::System.Runtime.InteropServices.UnmanagedType.LPUTF8Str)]") string "string"
+%typemap(out, fragment="SWIG_CSharpUTF8String", null="SWIG_CSharpUTF8String()") string
+%{ SWIG_CSharpUTF8StringBuffer().swap($1);
+   $result = SWIG_CSharpUTF8StringFrom(SWIG_CSharpUTF8StringBuffer()); %}
+%typemap(csout, excode=SWIGEXCODE) string {
+    string ret = $imcall.ToString();$excode
+    return ret;
+  }
+
+// const string &
+
+%typemap(ctype, out="SWIG_CSharpUTF8String") const string & "char *"
+%typemap(imtype, out="$imclassname.SWIGUTF8String", inattributes="[global::System.Runtime.InteropServices.MarshalAs(global::System.Runtime.InteropServices.UnmanagedType.LPUTF8Str)]") const string & "string"
+%typemap(out, fragment="SWIG_CSharpUTF8String", null="SWIG_CSharpUTF8String()") const string &
+%{ SWIG_CSharpUTF8StringBuffer() = *$1;
+   $result = SWIG_CSharpUTF8StringFrom(SWIG_CSharpUTF8StringBuffer()); %}
+%typemap(varout, fragment="SWIG_CSharpUTF8String", null="SWIG_CSharpUTF8String()") const string & %{ $result = SWIG_CSharpUTF8StringFrom(*$1); %}
+%typemap(csout, excode=SWIGEXCODE) const string & {
+    string ret = $imcall.ToString();$excode
+    return ret;
+  }
+%typemap(csvarout, excode=SWIGEXCODE2) const string & %{
+    get {
+      string ret = $imcall.ToString();$excode
+      return ret;
+    } %}
+
+}
+
+// std::vector<std::string> return values, inputs use the default typemaps
+
+%typemap(ctype, out="SWIG_CSharpUTF8StringArray") std::vector< std::string > "void *"
+%typemap(imtype, out="$imclassname.SWIGUTF8StringArray") std::vector< std::string > "global::System.Runtime.InteropServices.HandleRef"
+%typemap(cstype, out="string[]") std::vector< std::string > "$&csclassname"
+%typemap(out, fragment="SWIG_CSharpUTF8String", null="SWIG_CSharpUTF8StringArray()") std::vector< std::string >
+%{ SWIG_CSharpUTF8StringArrayBuffer().swap((std::vector< std::string > &)$1);
+   $result = SWIG_CSharpUTF8StringArrayFrom(SWIG_CSharpUTF8StringArrayBuffer()); %}
+%typemap(csout, excode=SWIGEXCODE) std::vector< std::string > {
+    string[] ret = $imcall.ToArray();$excode
+    return ret;
+  }
+
+%typemap(ctype, out="SWIG_CSharpUTF8StringArray") const std::vector< std::string > & "void *"
+%typemap(imtype, out="$imclassname.SWIGUTF8StringArray") const std::vector< std::string > & "global::System.Runtime.InteropServices.HandleRef"
+%typemap(cstype, out="string[]") const std::vector< std::string > & "$csclassname"
+%typemap(out, fragment="SWIG_CSharpUTF8String", null="SWIG_CSharpUTF8StringArray()") const std::vector< std::string > &
+%{ SWIG_CSharpUTF8StringArrayBuffer() = *$1;
+   $result = SWIG_CSharpUTF8StringArrayFrom(SWIG_CSharpUTF8StringArrayBuffer()); %}
+%typemap(varout, fragment="SWIG_CSharpUTF8String", null="SWIG_CSharpUTF8StringArray()") const std::vector< std::string > & %{ $result = SWIG_CSharpUTF8StringArrayFrom(*$1); %}
+%typemap(csout, excode=SWIGEXCODE) const std::vector< std::string > & {
+    string[] ret = $imcall.ToArray();$excode
+    return ret;
+  }
@@ -22,8 +22,8 @@
 
 %include <std_common.i>
 
-// MACRO for use within the std::vector class body
-%define SWIG_STD_VECTOR_MINIMUM_INTERNAL(CSINTERFACE, CONST_REFERENCE, CTYPE...)
+// MACRO for use within the std::vector class body, all but the element copying methods
+%define SWIG_STD_VECTOR_MINIMUM_BASE_INTERNAL(CSINTERFACE, CONST_REFERENCE, CTYPE...)
 %typemap(csinterfaces) std::vector< CTYPE > "global::System.IDisposable, global::System.Collections.IEnumerable\n    , global::System.Collections.Generic.CSINTERFACE<$typemap(cstype, CTYPE)>\n";
 %proxycode %{
   public $csclassname(global::System.Collections.IEnumerable c) : this() {
@@ -96,24 +96,6 @@
     CopyTo(0, array, arrayIndex, this.Count);
   }
 
-  public void CopyTo(int index, $typemap(cstype, CTYPE)[] array, int arrayIndex, int count)
-  {
-    if (array == null)
-      throw new global::System.ArgumentNullException("array");
-    if (index < 0)
-      throw new global::System.ArgumentOutOfRangeException("index", "Value is less than zero");
-    if (arrayIndex < 0)
-      throw new global::System.ArgumentOutOfRangeException("arrayIndex", "Value is less than zero");
-    if (count < 0)
-      throw new global::System.ArgumentOutOfRangeException("count", "Value is less than zero");
-    if (array.Rank > 1)
-      throw new global::System.ArgumentException("Multi dimensional array.", "array");
-    if (index+count > this.Count || arrayIndex+count > array.Length)
-      throw new global::System.ArgumentException("Number of elements to copy is too large.");
-    for (int i=0; i<count; i++)
-      array.SetValue(getitemcopy(index+i), arrayIndex+i);
-  }
-
   global::System.Collections.Generic.IEnumerator<$typemap(cstype, CTYPE)> global::System.Collections.Generic.IEnumerable<$typemap(cstype, CTYPE)>.GetEnumerator() {
     return new $csclassnameEnumerator(this);
   }
@@ -307,6 +289,120 @@
     }
 %enddef
 
+// MACRO for use within the std::vector class body
+%define SWIG_STD_VECTOR_MINIMUM_INTERNAL(CSINTERFACE, CONST_REFERENCE, CTYPE...)
+SWIG_STD_VECTOR_MINIMUM_BASE_INTERNAL(CSINTERFACE, %arg(CONST_REFERENCE), %arg(CTYPE))
+%proxycode %{
+  public void CopyTo(int index, $typemap(cstype, CTYPE)[] array, int arrayIndex, int count)
+  {
+    if (array == null)
+      throw new global::System.ArgumentNullException("array");
+    if (index < 0)
+      throw new global::System.ArgumentOutOfRangeException("index", "Value is less than zero");
+    if (arrayIndex < 0)
+      throw new global::System.ArgumentOutOfRangeException("arrayIndex", "Value is less than zero");
+    if (count < 0)
+      throw new global::System.ArgumentOutOfRangeException("count", "Value is less than zero");
+    if (array.Rank > 1)
+      throw new global::System.ArgumentException("Multi dimensional array.", "array");
+    if (index+count > this.Count || arrayIndex+count > array.Length)
+      throw new global::System.ArgumentException("Number of elements to copy is too large.");
+    for (int i=0; i<count; i++)
+      array.SetValue(getitemcopy(index+i), arrayIndex+i);
+  }
+%}
+%enddef
+
+// Array typemaps for the bulk copying methods, as per the INPUT[] and OUTPUT[] typemaps in arrays_csharp.i.
+// For use within the std::vector class body, they are cleared at the end of SWIG_STD_VECTOR_BULK_INTERNAL.
+%define SWIG_STD_VECTOR_ARRAY_TYPEMAPS(CTYPE...)
+%typemap(ctype)   CTYPE input[] "CTYPE*"
+%typemap(cstype)  CTYPE input[] "$typemap(cstype, CTYPE)[]"
+%typemap(imtype, inattributes="[global::System.Runtime.InteropServices.In, global::System.Runtime.InteropServices.MarshalAs(global::System.Runtime.InteropServices.UnmanagedType.LPArray)]") CTYPE input[] "$typemap(cstype, CTYPE)[]"
+%typemap(csin)    CTYPE input[] "$csinput"
+%typemap(in)      CTYPE input[] "$1 = $input;"
+
+%typemap(ctype)   CTYPE output[] "CTYPE*"
+%typemap(cstype)  CTYPE output[] "$typemap(cstype, CTYPE)[]"
+%typemap(imtype, inattributes="[global::System.Runtime.InteropServices.Out, global::System.Runtime.InteropServices.MarshalAs(global::System.Runtime.InteropServices.UnmanagedType.LPArray)]") CTYPE output[] "$typemap(cstype, CTYPE)[]"
+%typemap(csin)    CTYPE output[] "$csinput"
+%typemap(in)      CTYPE output[] "$1 = $input;"
+%enddef
+
+// MACRO for use within the std::vector class body for primitive types which have the same
+// representation in C# and C++. The C# arrays are pinned by the P/Invoke marshaller and
+// copied to and from the vector in a single call instead of one call per element.
+%define SWIG_STD_VECTOR_BULK_INTERNAL(CTYPE...)
+SWIG_STD_VECTOR_ARRAY_TYPEMAPS(CTYPE)
+%proxycode %{
+  public $csclassname($typemap(cstype, CTYPE)[] c) : this() {
+    if (c == null)
+      throw new global::System.ArgumentNullException("c");
+    AddRange(c, 0, c.Length);
+  }
+
+  public void CopyTo(int index, $typemap(cstype, CTYPE)[] array, int arrayIndex, int count)
+  {
+    CheckArrayRange(array, arrayIndex, count);
+    if (index < 0)
+      throw new global::System.ArgumentOutOfRangeException("index", "Value is less than zero");
+    if (index+count > this.Count)
+      throw new global::System.ArgumentException("Number of elements to copy is too large.");
+    copytoarray(index, array, arrayIndex, count);
+  }
+
+  public $typemap(cstype, CTYPE)[] ToArray() {
+    $typemap(cstype, CTYPE)[] array = new $typemap(cstype, CTYPE)[this.Count];
+    copytoarray(0, array, 0, array.Length);
+    return array;
+  }
+
+  public void AddRange($typemap(cstype, CTYPE)[] array, int arrayIndex, int count) {
+    InsertRange(this.Count, array, arrayIndex, count);
+  }
+
+  public void InsertRange(int index, $typemap(cstype, CTYPE)[] array, int arrayIndex, int count) {
+    CheckArrayRange(array, arrayIndex, count);
+    insertrangefromarray(index, array, arrayIndex, count);
+  }
+
+  public void SetRange(int index, $typemap(cstype, CTYPE)[] array, int arrayIndex, int count) {
+    CheckArrayRange(array, arrayIndex, count);
+    setrangefromarray(index, array, arrayIndex, count);
+  }
+
+  private static void CheckArrayRange($typemap(cstype, CTYPE)[] array, int arrayIndex, int count) {
+    if (array == null)
+      throw new global::System.ArgumentNullException("array");
+    if (arrayIndex < 0)
+      throw new global::System.ArgumentOutOfRangeException("arrayIndex", "Value is less than zero");
+    if (count < 0)
+      throw new global::System.ArgumentOutOfRangeException("count", "Value is less than zero");
+    if (arrayIndex+count > array.Length)
+      throw new global::System.ArgumentException("Number of elements to copy is too large.");
+  }
+%}
+
+    %extend {
+      void copytoarray(int index, CTYPE output[], int arrayIndex, int count) throw (std::out_of_range) {
+        if (index < 0 || index > (int)$self->size() - count)
+          throw std::out_of_range("index");
+        std::copy($self->begin()+index, $self->begin()+index+count, output+arrayIndex);
+      }
+      void insertrangefromarray(int index, CTYPE input[], int arrayIndex, int count) throw (std::out_of_range) {
+        if (index < 0 || index > (int)$self->size())
+          throw std::out_of_range("index");
+        $self->insert($self->begin()+index, input+arrayIndex, input+arrayIndex+count);
+      }
+      void setrangefromarray(int index, CTYPE input[], int arrayIndex, int count) throw (std::out_of_range) {
+        if (index < 0 || index > (int)$self->size() - count)
+          throw std::out_of_range("index");
+        std::copy(input+arrayIndex, input+arrayIndex+count, $self->begin()+index);
+      }
+    }
+%clear CTYPE input[], CTYPE output[];
+%enddef
+
 // Extra methods added to the collection class if operator== is defined for the class being wrapped
 // The class will then implement IList<>, which adds extra functionality
 %define SWIG_STD_VECTOR_EXTRA_OP_EQUALS_EQUALS(CTYPE...)
@@ -349,6 +445,16 @@ namespace std {
 }
 %enddef
 
+%define SWIG_STD_VECTOR_BULK_ENHANCED(CTYPE...)
+namespace std {
+  template<> class vector< CTYPE > {
+    SWIG_STD_VECTOR_MINIMUM_BASE_INTERNAL(IList, %arg(CTYPE const&), %arg(CTYPE))
+    SWIG_STD_VECTOR_BULK_INTERNAL(CTYPE)
+    SWIG_STD_VECTOR_EXTRA_OP_EQUALS_EQUALS(CTYPE)
+  };
+}
+%enddef
+
 // Legacy macros
 %define SWIG_STD_VECTOR_SPECIALIZE(CSTYPE, CTYPE...)
 #warning SWIG_STD_VECTOR_SPECIALIZE macro deprecated, please see csharp/std_vector.i and switch to SWIG_STD_VECTOR_ENHANCED
@@ -371,6 +477,9 @@ SWIG_STD_VECTOR_ENHANCED(CTYPE)
 %csmethodmodifiers std::vector::size "private"
 %csmethodmodifiers std::vector::capacity "private"
 %csmethodmodifiers std::vector::reserve "private"
+%csmethodmodifiers std::vector::copytoarray "private"
+%csmethodmodifiers std::vector::insertrangefromarray "private"
+%csmethodmodifiers std::vector::setrangefromarray "private"
 
 namespace std {
   // primary (unspecialized) class template for std::vector
@@ -392,19 +501,20 @@ namespace std {
 
 // template specializations for std::vector
 // these provide extra collections methods as operator== is defined
+// and bulk array copies for types with the same representation in C# and C++
 SWIG_STD_VECTOR_ENHANCED(char)
-SWIG_STD_VECTOR_ENHANCED(signed char)
-SWIG_STD_VECTOR_ENHANCED(unsigned char)
-SWIG_STD_VECTOR_ENHANCED(short)
-SWIG_STD_VECTOR_ENHANCED(unsigned short)
-SWIG_STD_VECTOR_ENHANCED(int)
-SWIG_STD_VECTOR_ENHANCED(unsigned int)
+SWIG_STD_VECTOR_BULK_ENHANCED(signed char)
+SWIG_STD_VECTOR_BULK_ENHANCED(unsigned char)
+SWIG_STD_VECTOR_BULK_ENHANCED(short)
+SWIG_STD_VECTOR_BULK_ENHANCED(unsigned short)
+SWIG_STD_VECTOR_BULK_ENHANCED(int)
+SWIG_STD_VECTOR_BULK_ENHANCED(unsigned int)
 SWIG_STD_VECTOR_ENHANCED(long)
 SWIG_STD_VECTOR_ENHANCED(unsigned long)
-SWIG_STD_VECTOR_ENHANCED(long long)
-SWIG_STD_VECTOR_ENHANCED(unsigned long long)
-SWIG_STD_VECTOR_ENHANCED(float)
-SWIG_STD_VECTOR_ENHANCED(double)
+SWIG_STD_VECTOR_BULK_ENHANCED(long long)
+SWIG_STD_VECTOR_BULK_ENHANCED(unsigned long long)
+SWIG_STD_VECTOR_BULK_ENHANCED(float)
+SWIG_STD_VECTOR_BULK_ENHANCED(double)
 SWIG_STD_VECTOR_ENHANCED(std::string) // also requires a %include <std_string.i>
 SWIG_STD_VECTOR_ENHANCED(std::wstring) // also requires a %include <std_wstring.i>
 
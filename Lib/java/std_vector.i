@@ -18,17 +18,11 @@ SWIGINTERN jint SWIG_VectorSize(size_t size) {
 }
 }
 
-%define SWIG_STD_VECTOR_MINIMUM_INTERNAL(CTYPE, CREF_TYPE)
+// All but the array constructor
+%define SWIG_STD_VECTOR_MINIMUM_BASE_INTERNAL(CTYPE, CREF_TYPE)
 %typemap(javabase) std::vector< CTYPE > "java.util.AbstractList<$typemap(jboxtype, CTYPE)>"
 %typemap(javainterfaces) std::vector< CTYPE > "java.util.RandomAccess"
 %proxycode %{
-  public $javaclassname($typemap(jstype, CTYPE)[] initialElements) {
-    this();
-    for ($typemap(jstype, CTYPE) element : initialElements) {
-      add(element);
-    }
-  }
-
   public $javaclassname(Iterable<$typemap(jboxtype, CTYPE)> initialElements) {
     this();
     for ($typemap(jstype, CTYPE) element : initialElements) {
@@ -141,12 +135,109 @@ SWIGINTERN jint SWIG_VectorSize(size_t size) {
     }
 %enddef
 
+%define SWIG_STD_VECTOR_MINIMUM_INTERNAL(CTYPE, CREF_TYPE)
+SWIG_STD_VECTOR_MINIMUM_BASE_INTERNAL(CTYPE, CREF_TYPE)
+%proxycode %{
+  public $javaclassname($typemap(jstype, CTYPE)[] initialElements) {
+    this();
+    for ($typemap(jstype, CTYPE) element : initialElements) {
+      add(element);
+    }
+  }
+%}
+%enddef
+
+// Bulk transfer between Java primitive arrays and vectors of primitive types with the same
+// representation as the JNI type, one JNI array region call per transfer instead of one call per element
+%define SWIG_STD_VECTOR_BULK_INTERNAL(CTYPE, JNITYPE, JFUNCTYPE)
+// JNIEnv for the array region calls, cleared at the end of the class body
+%typemap(in, numinputs=0) JNIEnv *SWIG_JNIENV "$1 = jenv;"
+%proxycode %{
+  public $javaclassname($typemap(jstype, CTYPE)[] initialElements) {
+    this();
+    addAll(initialElements);
+  }
+
+  public $typemap(jstype, CTYPE)[] toPrimitiveArray() {
+    return toPrimitiveArray(0, size());
+  }
+
+  public $typemap(jstype, CTYPE)[] toPrimitiveArray(int fromIndex, int toIndex) {
+    if (fromIndex < 0 || fromIndex > toIndex)
+      throw new IndexOutOfBoundsException("vector index out of range");
+    $typemap(jstype, CTYPE)[] array = new $typemap(jstype, CTYPE)[toIndex - fromIndex];
+    doGetRange(fromIndex, array, 0, array.length);
+    return array;
+  }
+
+  public void getRange(int fromIndex, $typemap(jstype, CTYPE)[] dest, int destPos, int length) {
+    if (destPos < 0 || length < 0 || destPos > dest.length - length)
+      throw new IndexOutOfBoundsException("array index out of range");
+    doGetRange(fromIndex, dest, destPos, length);
+  }
+
+  public void setRange(int index, $typemap(jstype, CTYPE)[] src, int srcPos, int length) {
+    if (srcPos < 0 || length < 0 || srcPos > src.length - length)
+      throw new IndexOutOfBoundsException("array index out of range");
+    doSetRange(index, src, srcPos, length);
+  }
+
+  public boolean addAll($typemap(jstype, CTYPE)[] values) {
+    return addAll(size(), values);
+  }
+
+  public boolean addAll(int index, $typemap(jstype, CTYPE)[] values) {
+    modCount++;
+    doInsertRange(index, values, 0, values.length);
+    return values.length != 0;
+  }
+%}
+
+    %extend {
+      void doGetRange(JNIEnv *SWIG_JNIENV, jint index, JNITYPE##Array array, jint arrayIndex, jint length) throw (std::out_of_range) {
+        const jint size = SWIG_VectorSize(self->size());
+        if (0 <= index && 0 <= length && index <= size - length) {
+          if (length > 0)
+            SWIG_JNIENV->Set##JFUNCTYPE##ArrayRegion(array, arrayIndex, length, (const JNITYPE *)&(*self)[index]);
+        } else {
+          throw std::out_of_range("vector index out of range");
+        }
+      }
+
+      void doSetRange(JNIEnv *SWIG_JNIENV, jint index, JNITYPE##Array array, jint arrayIndex, jint length) throw (std::out_of_range) {
+        const jint size = SWIG_VectorSize(self->size());
+        if (0 <= index && 0 <= length && index <= size - length) {
+          if (length > 0)
+            SWIG_JNIENV->Get##JFUNCTYPE##ArrayRegion(array, arrayIndex, length, (JNITYPE *)&(*self)[index]);
+        } else {
+          throw std::out_of_range("vector index out of range");
+        }
+      }
+
+      void doInsertRange(JNIEnv *SWIG_JNIENV, jint index, JNITYPE##Array array, jint arrayIndex, jint length) throw (std::out_of_range) {
+        const jint size = SWIG_VectorSize(self->size());
+        if (0 <= index && index <= size && 0 <= length) {
+          if (length > 0) {
+            self->insert(self->begin() + index, length, CTYPE());
+            SWIG_JNIENV->Get##JFUNCTYPE##ArrayRegion(array, arrayIndex, length, (JNITYPE *)&(*self)[index]);
+          }
+        } else {
+          throw std::out_of_range("vector index out of range");
+        }
+      }
+    }
+%clear JNIEnv *SWIG_JNIENV;
+%enddef
+
 %javamethodmodifiers std::vector::doSize        "private";
 %javamethodmodifiers std::vector::doAdd         "private";
 %javamethodmodifiers std::vector::doGet         "private";
 %javamethodmodifiers std::vector::doSet         "private";
 %javamethodmodifiers std::vector::doRemove      "private";
 %javamethodmodifiers std::vector::doRemoveRange "private";
+%javamethodmodifiers std::vector::doGetRange    "private";
+%javamethodmodifiers std::vector::doSetRange    "private";
+%javamethodmodifiers std::vector::doInsertRange "private";
 
 namespace std {
 
@@ -160,6 +251,23 @@ namespace std {
     };
 }
 
+// specializations for primitive types which can be copied to and from Java arrays in bulk
+%define SWIG_STD_VECTOR_BULK(CTYPE, JNITYPE, JFUNCTYPE)
+namespace std {
+    template<> class vector< CTYPE > {
+        SWIG_STD_VECTOR_MINIMUM_BASE_INTERNAL(CTYPE, const CTYPE&)
+        SWIG_STD_VECTOR_BULK_INTERNAL(CTYPE, JNITYPE, JFUNCTYPE)
+    };
+}
+%enddef
+
+SWIG_STD_VECTOR_BULK(signed char, jbyte, Byte)
+SWIG_STD_VECTOR_BULK(short, jshort, Short)
+SWIG_STD_VECTOR_BULK(int, jint, Int)
+SWIG_STD_VECTOR_BULK(long long, jlong, Long)
+SWIG_STD_VECTOR_BULK(float, jfloat, Float)
+SWIG_STD_VECTOR_BULK(double, jdouble, Double)
+
 %define specialize_std_vector(T)
 #warning "specialize_std_vector - specialization for type T no longer needed"
 %enddef
@@ -0,0 +1,92 @@
+/* -----------------------------------------------------------------------------
+ * typedarrays.i
+ *
+ * Typemaps passing JavaScript typed arrays and ArrayBuffers to C/C++ without copying
+ * and returning std::vector as typed arrays over an external ArrayBuffer.
+ *
+ * (CTYPE *DATA, size_t LENGTH) and (const CTYPE *DATA, size_t LENGTH) argument pairs
+ * accept a typed array of the matching element type or an ArrayBuffer. DATA points
+ * directly into the backing store of the array, which the function may modify, and
+ * LENGTH is the number of elements. The pointer must not be kept after the call returns.
+ *
+ * std::vector<CTYPE> return values are moved into the backing store of a new
+ * ArrayBuffer, which deletes the vector when it is garbage collected.
+ *
+ * Requires a JavaScriptCore version providing the typed array API of JSTypedArray.h.
+ *
+ * Example usage:
+ *
+ *   %include <typedarrays.i>
+ *   %apply (float *DATA, size_t LENGTH) { (float *pixels, size_t count) };
+ *   void brighten(float *pixels, size_t count, float amount);
+ *   std::vector<unsigned char> histogram(const unsigned char *DATA, size_t LENGTH);
+ *
+ * Use from JavaScript like this:
+ *
+ *   var pixels = new Float32Array(1024);
+ *   example.brighten(pixels, 0.5);
+ *   var h = example.histogram(new Uint8Array(buffer));   // h is a Uint8Array
+ * ----------------------------------------------------------------------------- */
+
+%fragment("SWIGJSC_TypedArrays", "header") %{
+#include <vector>
+#include <JavaScriptCore/JSTypedArray.h>
+
+/* Gets the memory of a typed array of the given type or of an ArrayBuffer */
+SWIGINTERN bool SWIGJSC_GetArrayBufferData(JSContextRef context, JSValueRef value, JSTypedArrayType type, void **data, size_t *length) {
+  JSTypedArrayType actual = JSValueGetTypedArrayType(context, value, NULL);
+  if (actual == type) {
+    JSObjectRef array = JSValueToObject(context, value, NULL);
+    *data = (char *)JSObjectGetTypedArrayBytesPtr(context, array, NULL) + JSObjectGetTypedArrayByteOffset(context, array, NULL);
+    *length = JSObjectGetTypedArrayByteLength(context, array, NULL);
+    return true;
+  }
+  if (actual == kJSTypedArrayTypeArrayBuffer) {
+    JSObjectRef buffer = JSValueToObject(context, value, NULL);
+    *data = JSObjectGetArrayBufferBytesPtr(context, buffer, NULL);
+    *length = JSObjectGetArrayBufferByteLength(context, buffer, NULL);
+    return true;
+  }
+  return false;
+}
+
+template <typename T> SWIGINTERN void SWIGJSC_DeleteVector(void *, void *vector) {
+  delete static_cast<std::vector<T> *>(vector);
+}
+
+template <typename T> SWIGINTERN JSObjectRef SWIGJSC_NewExternalTypedArray(JSContextRef context, std::vector<T> &v, JSTypedArrayType type) {
+  std::vector<T> *external = new std::vector<T>();
+  external->swap(v);
+  JSObjectRef buffer = JSObjectMakeArrayBufferWithBytesNoCopy(context, external->empty() ? 0 : &(*external)[0],
+    external->size() * sizeof(T), SWIGJSC_DeleteVector<T>, external, NULL);
+  return JSObjectMakeTypedArrayWithArrayBuffer(context, type, buffer, NULL);
+}
+%}
+
+%define %typedarray_typemaps(CTYPE, JSTYPE)
+%typemap(in, fragment="SWIGJSC_TypedArrays") (CTYPE *DATA, size_t LENGTH), (const CTYPE *DATA, size_t LENGTH) (void *data = 0, size_t length = 0) {
+  if (!SWIGJSC_GetArrayBufferData(context, $input, kJSTypedArrayType ## JSTYPE, &data, &length)) {
+    SWIG_exception_fail(SWIG_TypeError, "in method '" "$symname" "', argument " "$argnum" " is not a " #JSTYPE " or ArrayBuffer");
+  }
+  $1 = ($1_ltype)data;
+  $2 = ($2_ltype)(length / sizeof(CTYPE));
+}
+%typemap(typecheck, precedence=SWIG_TYPECHECK_POINTER, fragment="SWIGJSC_TypedArrays") (CTYPE *DATA, size_t LENGTH), (const CTYPE *DATA, size_t LENGTH) {
+  {
+    JSTypedArrayType type = JSValueGetTypedArrayType(context, $input, NULL);
+    $1 = type == kJSTypedArrayType ## JSTYPE || type == kJSTypedArrayTypeArrayBuffer;
+  }
+}
+%typemap(out, fragment="SWIGJSC_TypedArrays") std::vector< CTYPE > {
+  $result = SWIGJSC_NewExternalTypedArray(context, (std::vector< CTYPE > &)$1, kJSTypedArrayType ## JSTYPE);
+}
+%enddef
+
+%typedarray_typemaps(signed char, Int8Array)
+%typedarray_typemaps(unsigned char, Uint8Array)
+%typedarray_typemaps(short, Int16Array)
+%typedarray_typemaps(unsigned short, Uint16Array)
+%typedarray_typemaps(int, Int32Array)
+%typedarray_typemaps(unsigned int, Uint32Array)
+%typedarray_typemaps(float, Float32Array)
+%typedarray_typemaps(double, Float64Array)
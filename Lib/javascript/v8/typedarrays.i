@@ -0,0 +1,108 @@
+/* -----------------------------------------------------------------------------
+ * typedarrays.i
+ *
+ * Typemaps passing JavaScript typed arrays and ArrayBuffers to C/C++ without copying
+ * and returning std::vector as typed arrays over an external ArrayBuffer.
+ *
+ * (CTYPE *DATA, size_t LENGTH) and (const CTYPE *DATA, size_t LENGTH) argument pairs
+ * accept a typed array of the matching element type or an ArrayBuffer. DATA points
+ * directly into the backing store of the array, which the function may modify, and
+ * LENGTH is the number of elements. The pointer must not be kept after the call returns.
+ *
+ * std::vector<CTYPE> return values are moved into the backing store of a new
+ * ArrayBuffer, which deletes the vector when it is garbage collected.
+ *
+ * Requires V8 4.0 or later (node.js 4 or later).
+ *
+ * Example usage:
+ *
+ *   %include <typedarrays.i>
+ *   %apply (float *DATA, size_t LENGTH) { (float *pixels, size_t count) };
+ *   void brighten(float *pixels, size_t count, float amount);
+ *   std::vector<unsigned char> histogram(const unsigned char *DATA, size_t LENGTH);
+ *
+ * Use from JavaScript like this:
+ *
+ *   var pixels = new Float32Array(1024);
+ *   example.brighten(pixels, 0.5);
+ *   var h = example.histogram(new Uint8Array(buffer));   // h is a Uint8Array
+ * ----------------------------------------------------------------------------- */
+
+%fragment("SWIGV8_TypedArrays", "header") %{
+#include <vector>
+
+#if (V8_MAJOR_VERSION-0) < 4
+#error "typedarrays.i requires v8 4.0 or later"
+#endif
+
+/* Gets the memory of a typed array (view is true if the value is a typed array of the
+   expected type) or of an ArrayBuffer */
+SWIGINTERN bool SWIGV8_GetArrayBufferData(v8::Handle<v8::Value> value, bool view, void **data, size_t *length) {
+  if (view) {
+    v8::Local<v8::ArrayBufferView> array = v8::Local<v8::ArrayBufferView>::Cast(value);
+    *data = (char *)array->Buffer()->GetContents().Data() + array->ByteOffset();
+    *length = array->ByteLength();
+    return true;
+  }
+  if (value->IsArrayBuffer()) {
+    v8::ArrayBuffer::Contents contents = v8::Local<v8::ArrayBuffer>::Cast(value)->GetContents();
+    *data = contents.Data();
+    *length = contents.ByteLength();
+    return true;
+  }
+  return false;
+}
+
+/* Owns a vector used as the backing store of an external ArrayBuffer */
+template <typename T> class SWIGV8_ExternalVector {
+public:
+  std::vector<T> data;
+  v8::Persistent<v8::ArrayBuffer> handle;
+
+  static void release(const v8::WeakCallbackData<v8::ArrayBuffer, SWIGV8_ExternalVector<T> > &info) {
+    SWIGV8_ExternalVector<T> *external = info.GetParameter();
+    SWIGV8_ADJUST_MEMORY(-(int64_t)(external->data.size() * sizeof(T)));
+    external->handle.Reset();
+    delete external;
+  }
+};
+
+template <typename T> SWIGINTERN v8::Local<v8::ArrayBuffer> SWIGV8_NewExternalArrayBuffer(std::vector<T> &v) {
+  v8::Isolate *isolate = v8::Isolate::GetCurrent();
+  SWIGV8_ExternalVector<T> *external = new SWIGV8_ExternalVector<T>();
+  external->data.swap(v);
+  size_t length = external->data.size() * sizeof(T);
+  v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(isolate, length ? &external->data[0] : 0, length);
+  external->handle.Reset(isolate, buffer);
+  external->handle.SetWeak(external, SWIGV8_ExternalVector<T>::release);
+  external->handle.MarkIndependent();
+  SWIGV8_ADJUST_MEMORY((int64_t)length);
+  return buffer;
+}
+%}
+
+%define %typedarray_typemaps(CTYPE, JSTYPE)
+%typemap(in, fragment="SWIGV8_TypedArrays") (CTYPE *DATA, size_t LENGTH), (const CTYPE *DATA, size_t LENGTH) (void *data = 0, size_t length = 0) {
+  if (!SWIGV8_GetArrayBufferData($input, $input->Is ## JSTYPE(), &data, &length)) {
+    SWIG_exception_fail(SWIG_TypeError, "in method '" "$symname" "', argument " "$argnum" " is not a " #JSTYPE " or ArrayBuffer");
+  }
+  $1 = ($1_ltype)data;
+  $2 = ($2_ltype)(length / sizeof(CTYPE));
+}
+%typemap(typecheck, precedence=SWIG_TYPECHECK_POINTER) (CTYPE *DATA, size_t LENGTH), (const CTYPE *DATA, size_t LENGTH) {
+  $1 = $input->Is ## JSTYPE() || $input->IsArrayBuffer();
+}
+%typemap(out, fragment="SWIGV8_TypedArrays") std::vector< CTYPE > {
+  v8::Local<v8::ArrayBuffer> buffer = SWIGV8_NewExternalArrayBuffer((std::vector< CTYPE > &)$1);
+  $result = v8::JSTYPE::New(buffer, 0, buffer->ByteLength() / sizeof(CTYPE));
+}
+%enddef
+
+%typedarray_typemaps(signed char, Int8Array)
+%typedarray_typemaps(unsigned char, Uint8Array)
+%typedarray_typemaps(short, Int16Array)
+%typedarray_typemaps(unsigned short, Uint16Array)
+%typedarray_typemaps(int, Int32Array)
+%typedarray_typemaps(unsigned int, Uint32Array)
+%typedarray_typemaps(float, Float32Array)
+%typedarray_typemaps(double, Float64Array)
@@ -0,0 +1,40 @@
+/* -----------------------------------------------------------------------------
+ * lua_inline.i
+ *
+ * Storage of small value types inside the Lua userdata.
+ * ----------------------------------------------------------------------------- */
+
+/*
+By default a struct or class returned by value is copied into a new heap allocated
+object and the Lua userdata holds a pointer to it, which is deleted when the userdata
+is garbage collected. For small types, such as vectors, that are created in large
+numbers this is two allocations per value.
+
+%lua_inline(TYPE) changes the return by value typemap for TYPE so that the value is
+copied into the userdata block itself. The objects behave like any other wrapped
+object, they have the same metatable and can be passed to functions taking TYPE,
+TYPE * or TYPE &, but no destructor is called when they are garbage collected.
+
+  %include <lua_inline.i>
+  %lua_inline(Vec3)
+
+  struct Vec3 { float x, y, z; };
+  Vec3 cross(const Vec3 &a, const Vec3 &b);
+
+TYPE must be trivially copyable and trivially destructible (a POD type) as it is
+copied with memcpy and never destroyed. Objects created by calling the constructor
+from Lua are still heap allocated. As the value is freed by the Lua garbage collector,
+inline objects must not be passed to functions taking ownership (DISOWN typemaps).
+*/
+
+#ifdef __cplusplus
+%define %lua_inline(TYPE...)
+%typemap(out) TYPE
+%{ SWIG_Lua_NewInlineObj(L,(const void *)&((const $1_ltype &)$1),sizeof($1_ltype),$&1_descriptor); SWIG_arg++; %}
+%enddef
+#else
+%define %lua_inline(TYPE...)
+%typemap(out) TYPE
+%{ SWIG_Lua_NewInlineObj(L,(const void *)&$1,sizeof($1_type),$&1_descriptor); SWIG_arg++; %}
+%enddef
+#endif
@@ -2,7 +2,7 @@
   Maps
 */
 
-%fragment("StdMapCommonTraits","header",fragment="StdSequenceTraits")
+%fragment("StdMapCommonTraits","header",fragment="StdSequenceTraits",fragment="SwigPyNativeIterator")
 {
   namespace swig {
     template <class ValueType>
@@ -71,6 +71,13 @@
     {
       return new SwigPyMapValueITerator_T<OutIter>(current, begin, end, seq);
     }
+
+    template<typename OutIter>
+    inline PyObject *
+    make_native_key_iterator(const OutIter& begin, const OutIter& end, PyObject *seq = 0)
+    {
+      return SwigPyNativeIterator<OutIter, from_key_oper<typename OutIter::value_type> >::create(begin, end, seq);
+    }
   }
 }
 
@@ -82,8 +89,10 @@
     assign(const SwigPySeq& swigpyseq, std::map<K,T,Compare,Alloc > *map) {
       typedef typename std::map<K,T,Compare,Alloc >::value_type value_type;
       typename SwigPySeq::const_iterator it = swigpyseq.begin();
-      for (;it != swigpyseq.end(); ++it) {
-	map->insert(value_type(it->first, it->second));
+      typename SwigPySeq::const_iterator end = swigpyseq.end();
+      for (;it != end; ++it) {
+	typename SwigPySeq::value_type item = *it;
+	map->insert(value_type(item.first, item.second));
       }
     }
 
@@ -149,13 +158,12 @@
 }
 
 %define %swig_map_common(Map...)
-  %swig_sequence_iterator(Map);
+  %swig_sequence_iterator_with_making_functions(swig::make_output_iterator, swig::make_native_key_iterator, Map);
   %swig_container_methods(Map)
 
 #if defined(SWIGPYTHON_BUILTIN)
   %feature("python:slot", "mp_length", functype="lenfunc") __len__;
   %feature("python:slot", "mp_subscript", functype="binaryfunc") __getitem__;
-  %feature("python:slot", "tp_iter", functype="getiterfunc") key_iterator;
 
   %extend {
     %newobject iterkeys(PyObject **PYTHON_SELF);
@@ -176,8 +184,6 @@
 
 #else
   %extend {
-    %pythoncode %{def __iter__(self):
-    return self.key_iterator()%}
     %pythoncode %{def iterkeys(self):
     return self.key_iterator()%}
     %pythoncode %{def itervalues(self):
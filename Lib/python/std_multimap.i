@@ -11,8 +11,10 @@
     assign(const SwigPySeq& swigpyseq, std::multimap<K,T > *multimap) {
       typedef typename std::multimap<K,T>::value_type value_type;
       typename SwigPySeq::const_iterator it = swigpyseq.begin();
-      for (;it != swigpyseq.end(); ++it) {
-	multimap->insert(value_type(it->first, it->second));
+      typename SwigPySeq::const_iterator end = swigpyseq.end();
+      for (;it != end; ++it) {
+	typename SwigPySeq::value_type item = *it;
+	multimap->insert(value_type(item.first, item.second));
       }
     }
 
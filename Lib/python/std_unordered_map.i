@@ -10,8 +10,11 @@
     assign(const SwigPySeq& swigpyseq, std::unordered_map<K,T > *unordered_map) {
       typedef typename std::unordered_map<K,T>::value_type value_type;
       typename SwigPySeq::const_iterator it = swigpyseq.begin();
-      for (;it != swigpyseq.end(); ++it) {
-	unordered_map->insert(value_type(it->first, it->second));
+      typename SwigPySeq::const_iterator end = swigpyseq.end();
+      unordered_map->reserve(swigpyseq.size());
+      for (;it != end; ++it) {
+	typename SwigPySeq::value_type item = *it;
+	unordered_map->insert(value_type(item.first, item.second));
       }
     }
 
@@ -122,7 +125,7 @@
 }
 
 %define %swig_unordered_map_common(Map...)
-  %swig_sequence_forward_iterator(Map);
+  %swig_sequence_iterator_with_making_functions(swig::make_output_forward_iterator, swig::make_native_key_iterator, Map);
   %swig_container_methods(Map)
 
   %extend {
@@ -213,8 +216,6 @@
       return swig::make_output_value_forward_iterator(self->begin(), self->begin(), self->end(), *PYTHON_SELF);
     }
 
-    %pythoncode %{def __iter__(self):
-    return self.key_iterator()%}
     %pythoncode %{def iterkeys(self):
     return self.key_iterator()%}
     %pythoncode %{def itervalues(self):
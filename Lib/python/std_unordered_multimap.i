@@ -11,8 +11,11 @@
     assign(const SwigPySeq& swigpyseq, std::unordered_multimap<K,T > *unordered_multimap) {
       typedef typename std::unordered_multimap<K,T>::value_type value_type;
       typename SwigPySeq::const_iterator it = swigpyseq.begin();
-      for (;it != swigpyseq.end(); ++it) {
-	unordered_multimap->insert(value_type(it->first, it->second));
+      typename SwigPySeq::const_iterator end = swigpyseq.end();
+      unordered_multimap->reserve(swigpyseq.size());
+      for (;it != end; ++it) {
+	typename SwigPySeq::value_type item = *it;
+	unordered_multimap->insert(value_type(item.first, item.second));
       }
     }
 
@@ -11,7 +11,9 @@
       // seq->insert(swigpyseq.begin(), swigpyseq.end()); // not used as not always implemented
       typedef typename SwigPySeq::value_type value_type;
       typename SwigPySeq::const_iterator it = swigpyseq.begin();
-      for (;it != swigpyseq.end(); ++it) {
+      typename SwigPySeq::const_iterator end = swigpyseq.end();
+      seq->reserve(swigpyseq.size());
+      for (;it != end; ++it) {
 	seq->insert(seq->end(),(value_type)(*it));
       }
     }
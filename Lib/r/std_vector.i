@@ -3,181 +3,225 @@
   Vectors
 */
 
-%fragment("StdVectorTraits","header",fragment="StdSequenceTraits")
+// Creates the ALTREP classes of the module, see SWIG_R_ALTREP_VECTORS below
+%fragment("StdVectorAltrepInit","sinitroutine")
 %{
+#if defined(SWIG_R_ALTREP_VECTORS) && R_VERSION >= R_Version(3,5,0)
+swig::r_altrep_vector_init(dll);
+#endif
+%}
+
+%fragment("StdVectorTraits","header",fragment="StdSequenceTraits",fragment="StdVectorAltrepInit")
+%{
+#include <algorithm>
+#if defined(SWIG_R_ALTREP_VECTORS) && R_VERSION >= R_Version(3,5,0)
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <R_ext/Altrep.h>
+#ifdef __cplusplus
+}
+#endif
+#endif
+
   namespace swig {
-    // vectors of doubles
-    template <>
-      struct traits_from_ptr<std::vector<double> > {
-      static SEXP from (std::vector<double > *val, int owner = 0) {
-        SEXP result;
-        PROTECT(result = Rf_allocVector(REALSXP, val->size()));
-        for (unsigned pos = 0; pos < val->size(); pos++)
-          {
-            NUMERIC_POINTER(result)[pos] = ((*val)[pos]);
-          }
-        UNPROTECT(1);
-        return(result);
-      }
+    // Storage of the R vectors holding arithmetic elements
+    template <typename RT> struct r_vector_storage;
+    template <> struct r_vector_storage<double> {
+      static SEXPTYPE type() { return REALSXP; }
+      static double *data(SEXP x) { return NUMERIC_POINTER(x); }
     };
-    // vectors of floats
-    template <>
-      struct traits_from_ptr<std::vector<float> > {
-      static SEXP from (std::vector<float > *val, int owner = 0) {
-        SEXP result;
-        PROTECT(result = Rf_allocVector(REALSXP, val->size()));
-        for (unsigned pos = 0; pos < val->size(); pos++)
-          {
-            NUMERIC_POINTER(result)[pos] = ((*val)[pos]);
-          }
-        UNPROTECT(1);
-        return(result);
-      }
+    template <> struct r_vector_storage<int> {
+      static SEXPTYPE type() { return INTSXP; }
+      static int *data(SEXP x) { return INTEGER_POINTER(x); }
     };
-    // vectors of unsigned 8bit int
-    template <>
-      struct traits_from_ptr<std::vector<unsigned char> > {
-      static SEXP from (std::vector<unsigned char > *val, int owner = 0) {
-        SEXP result;
-        PROTECT(result = Rf_allocVector(INTSXP, val->size()));
-        for (unsigned pos = 0; pos < val->size(); pos++)
-          {
-            INTEGER_POINTER(result)[pos] = ((*val)[pos]);
-          }
-        UNPROTECT(1);
-        return(result);
-      }
+
+    // Exposes a vector owned by the wrapper to R without copying it, see
+    // SWIG_R_ALTREP_VECTORS below.  The default is to copy.
+    template <typename T, typename RT> struct r_vector_altrep {
+      static SEXP make(std::vector<T> *) { return 0; }
     };
-    // vectors of 8bit int
-    template <>
-      struct traits_from_ptr<std::vector<signed char> > {
-      static SEXP from (std::vector<signed char > *val, int owner = 0) {
-        SEXP result;
-        PROTECT(result = Rf_allocVector(INTSXP, val->size()));
-        for (unsigned pos = 0; pos < val->size(); pos++)
-          {
-            INTEGER_POINTER(result)[pos] = ((*val)[pos]);
-          }
+
+#if defined(SWIG_R_ALTREP_VECTORS) && R_VERSION >= R_Version(3,5,0)
+    // The ALTREP classes are created with the DllInfo of the module in its
+    // R_init_<package> routine and named after the module, so that modules
+    // do not replace the classes of each other.  Without the init routine
+    // (-no-init-code) vectors are copied.
+    template <typename T> struct r_altrep_vector {
+      static R_altrep_class_t cls;
+      static bool initialized;
+      static std::vector<T> *get(SEXP x) {
+        return static_cast<std::vector<T> *>(R_ExternalPtrAddr(R_altrep_data1(x)));
+      }
+      static R_xlen_t length(SEXP x) {
+        return (R_xlen_t)get(x)->size();
+      }
+      static void *dataptr(SEXP x, Rboolean) {
+        return &(*get(x))[0];
+      }
+      static const void *dataptr_or_null(SEXP x) {
+        return &(*get(x))[0];
+      }
+      static void finalize(SEXP ptr) {
+        delete static_cast<std::vector<T> *>(R_ExternalPtrAddr(ptr));
+        R_ClearExternalPtr(ptr);
+      }
+      static void set_methods(R_altrep_class_t c) {
+        R_set_altrep_Length_method(c, length);
+        R_set_altvec_Dataptr_method(c, dataptr);
+        R_set_altvec_Dataptr_or_null_method(c, dataptr_or_null);
+        cls = c;
+        initialized = true;
+      }
+      static SEXP make(std::vector<T> *val) {
+        SEXP ptr, result;
+        if (!initialized)
+          return 0;
+        PROTECT(ptr = R_MakeExternalPtr(val, R_NilValue, R_NilValue));
+        R_RegisterCFinalizerEx(ptr, finalize, TRUE);
+        result = R_new_altrep(cls, ptr, R_NilValue);
         UNPROTECT(1);
-        return(result);
+        return result;
       }
     };
+    template <typename T> R_altrep_class_t r_altrep_vector<T>::cls;
+    template <typename T> bool r_altrep_vector<T>::initialized = false;
 
-    // vectors of unsigned 16bit int
-    template <>
-      struct traits_from_ptr<std::vector<unsigned short int> > {
-      static SEXP from (std::vector<unsigned short int > *val, int owner = 0) {
-        SEXP result;
-        PROTECT(result = Rf_allocVector(INTSXP, val->size()));
-        for (unsigned pos = 0; pos < val->size(); pos++)
-          {
-            INTEGER_POINTER(result)[pos] = ((*val)[pos]);
-          }
-        UNPROTECT(1);
-        return(result);
+    SWIGINTERN void r_altrep_vector_init(DllInfo *dll) {
+      r_altrep_vector<double>::set_methods(R_make_altreal_class("swig_std_vector_double_" SWIG_name, SWIG_R_PACKAGE, dll));
+      r_altrep_vector<int>::set_methods(R_make_altinteger_class("swig_std_vector_int_" SWIG_name, SWIG_R_PACKAGE, dll));
+    }
+
+    template <> struct r_vector_altrep<double, double> {
+      static SEXP make(std::vector<double> *val) {
+        return r_altrep_vector<double>::make(val);
       }
     };
-    // vectors of 16bit int
-    template <>
-      struct traits_from_ptr<std::vector<short int> > {
-      static SEXP from (std::vector<short int > *val, int owner = 0) {
-        SEXP result;
-        PROTECT(result = Rf_allocVector(INTSXP, val->size()));
-        for (unsigned pos = 0; pos < val->size(); pos++)
-          {
-            INTEGER_POINTER(result)[pos] = ((*val)[pos]);
-          }
-        UNPROTECT(1);
-        return(result);
+
+    template <> struct r_vector_altrep<int, int> {
+      static SEXP make(std::vector<int> *val) {
+        return r_altrep_vector<int>::make(val);
       }
     };
+#endif
 
-   // vectors of 32 bit unsigned int
-    template <>
-      struct traits_from_ptr<std::vector<unsigned int> > {
-      static SEXP from (std::vector<unsigned int> *val, int owner = 0) {
+    // Converts a vector of arithmetic elements to an R vector with elements
+    // of type RT.  std::copy is a single memmove when T and RT are the same.
+    // A vector owned by the caller is deleted, or handed over to R when
+    // SWIG_R_ALTREP_VECTORS is defined.
+    template <typename T, typename RT>
+      struct r_vector_from {
+      static SEXP from(std::vector<T> *val, int owner = 0) {
         SEXP result;
-        PROTECT(result = Rf_allocVector(INTSXP, val->size()));
-        for (unsigned pos = 0; pos < val->size(); pos++)
-          {
-            INTEGER_POINTER(result)[pos] = ((*val)[pos]);
-          }
+        if (owner && !val->empty()) {
+          result = r_vector_altrep<T, RT>::make(val);
+          if (result)
+            return result;
+        }
+        PROTECT(result = Rf_allocVector(r_vector_storage<RT>::type(), val->size()));
+        std::copy(val->begin(), val->end(), r_vector_storage<RT>::data(result));
         UNPROTECT(1);
+        if (owner)
+          delete val;
         return(result);
       }
     };
 
-    // vectors of 32bit int
-    template <>
-      struct traits_from_ptr<std::vector<int> > {
-      static SEXP from (std::vector<int > *val, int owner = 0) {
-        SEXP result;
-        PROTECT(result = Rf_allocVector(INTSXP, val->size()));
-        for (unsigned pos = 0; pos < val->size(); pos++)
-          {
-            INTEGER_POINTER(result)[pos] = ((*val)[pos]);
-          }
+    // Converts an R vector to a new vector of arithmetic elements, reading the
+    // elements directly from the R vector coerced to elements of type RT.
+    template <typename T, typename RT>
+      struct r_vector_asptr {
+      static int asptr(SEXP obj, std::vector<T> **val) {
+        SEXP coerced;
+        PROTECT(coerced = Rf_coerceVector(obj, r_vector_storage<RT>::type()));
+        const RT *S = r_vector_storage<RT>::data(coerced);
+        std::vector<T> *p = new std::vector<T>(S, S + Rf_xlength(coerced));
         UNPROTECT(1);
-        return(result);
+        if (val) {
+          *val = p;
+        } else {
+          delete p;
+        }
+        return SWIG_NEWOBJ;
       }
     };
 
-   // vectors of 64 bit unsigned int
+    // vectors of doubles and floats
+    template <>
+      struct traits_from_ptr<std::vector<double> > : r_vector_from<double, double> {
+    };
+    template <>
+      struct traits_asptr<std::vector<double> > : r_vector_asptr<double, double> {
+    };
+    template <>
+      struct traits_from_ptr<std::vector<float> > : r_vector_from<float, double> {
+    };
+    template <>
+      struct traits_asptr<std::vector<float> > : r_vector_asptr<float, double> {
+    };
+    // vectors of 8 bit, 16 bit and 32 bit integers
+    template <>
+      struct traits_from_ptr<std::vector<unsigned char> > : r_vector_from<unsigned char, int> {
+    };
+    template <>
+      struct traits_asptr<std::vector<unsigned char> > : r_vector_asptr<unsigned char, int> {
+    };
+    template <>
+      struct traits_from_ptr<std::vector<signed char> > : r_vector_from<signed char, int> {
+    };
+    template <>
+      struct traits_asptr<std::vector<signed char> > : r_vector_asptr<signed char, int> {
+    };
+    template <>
+      struct traits_from_ptr<std::vector<unsigned short int> > : r_vector_from<unsigned short int, int> {
+    };
+    template <>
+      struct traits_asptr<std::vector<unsigned short int> > : r_vector_asptr<unsigned short int, int> {
+    };
+    template <>
+      struct traits_from_ptr<std::vector<short int> > : r_vector_from<short int, int> {
+    };
+    template <>
+      struct traits_asptr<std::vector<short int> > : r_vector_asptr<short int, int> {
+    };
+    template <>
+      struct traits_from_ptr<std::vector<unsigned int> > : r_vector_from<unsigned int, int> {
+    };
+    template <>
+      struct traits_asptr<std::vector<unsigned int> > : r_vector_asptr<unsigned int, int> {
+    };
+    template <>
+      struct traits_from_ptr<std::vector<int> > : r_vector_from<int, int> {
+    };
+    template <>
+      struct traits_asptr<std::vector<int> > : r_vector_asptr<int, int> {
+    };
+    // vectors of 64 bit integers
 #if defined(SWIGWORDSIZE64)
     template <>
-      struct traits_from_ptr<std::vector<unsigned long int> > {
-      static SEXP from (std::vector<unsigned long int> *val, int owner = 0) {
-        SEXP result;
-        PROTECT(result = Rf_allocVector(INTSXP, val->size()));
-        for (unsigned pos = 0; pos < val->size(); pos++)
-          {
-            INTEGER_POINTER(result)[pos] = ((*val)[pos]);
-          }
-        UNPROTECT(1);
-        return(result);
-      }
+      struct traits_from_ptr<std::vector<unsigned long int> > : r_vector_from<unsigned long int, int> {
     };
-     // vectors of 64 bit int
     template <>
-      struct traits_from_ptr<std::vector<long int> > {
-      static SEXP from (std::vector<long int> *val, int owner = 0) {
-        SEXP result;
-        PROTECT(result = Rf_allocVector(INTSXP, val->size()));
-        for (unsigned pos = 0; pos < val->size(); pos++)
-          {
-            INTEGER_POINTER(result)[pos] = ((*val)[pos]);
-          }
-        UNPROTECT(1);
-        return(result);
-      }
+      struct traits_asptr<std::vector<unsigned long int> > : r_vector_asptr<unsigned long int, int> {
+    };
+    template <>
+      struct traits_from_ptr<std::vector<long int> > : r_vector_from<long int, int> {
+    };
+    template <>
+      struct traits_asptr<std::vector<long int> > : r_vector_asptr<long int, int> {
     };
 #else
     template <>
-      struct traits_from_ptr<std::vector<unsigned long long int> > {
-      static SEXP from (std::vector<unsigned long long int> *val, int owner = 0) {
-        SEXP result;
-        PROTECT(result = Rf_allocVector(INTSXP, val->size()));
-        for (unsigned pos = 0; pos < val->size(); pos++)
-          {
-            INTEGER_POINTER(result)[pos] = ((*val)[pos]);
-          }
-        UNPROTECT(1);
-        return(result);
-      }
+      struct traits_from_ptr<std::vector<unsigned long long int> > : r_vector_from<unsigned long long int, int> {
     };
-     // vectors of 64 bit int
     template <>
-      struct traits_from_ptr<std::vector<long long int> > {
-      static SEXP from (std::vector<long long int> *val, int owner = 0) {
-        SEXP result;
-        PROTECT(result = Rf_allocVector(INTSXP, val->size()));
-        for (unsigned pos = 0; pos < val->size(); pos++)
-          {
-            INTEGER_POINTER(result)[pos] = ((*val)[pos]);
-          }
-        UNPROTECT(1);
-        return(result);
-      }
+      struct traits_asptr<std::vector<unsigned long long int> > : r_vector_asptr<unsigned long long int, int> {
+    };
+    template <>
+      struct traits_from_ptr<std::vector<long long int> > : r_vector_from<long long int, int> {
+    };
+    template <>
+      struct traits_asptr<std::vector<long long int> > : r_vector_asptr<long long int, int> {
     };
 #endif
     // vectors of bool
@@ -218,278 +262,6 @@
       }
     };
     /////////////////////////////////////////////////
-    template <>
-  struct traits_asptr < std::vector<double> > {
-    static int asptr(SEXP obj, std::vector<double> **val) {
-      std::vector<double> *p;
-      // not sure how to check the size of the SEXP obj is correct
-      unsigned int sexpsz = Rf_length(obj);
-      p = new std::vector<double>(sexpsz);
-      double *S = NUMERIC_POINTER(obj);
-      for (unsigned pos = 0; pos < p->size(); pos++)
-        {
-          (*p)[pos] = static_cast<double>(S[pos]);
-        }
-      int res = SWIG_OK;
-      if (SWIG_IsOK(res)) {
-        if (val) *val = p;
-      }
-      return res;
-    }
-  };
-
-    template <>
-  struct traits_asptr < std::vector<float> > {
-    static int asptr(SEXP obj, std::vector<float> **val) {
-      std::vector<float> *p;
-      // not sure how to check the size of the SEXP obj is correct
-      unsigned int sexpsz = Rf_length(obj);
-      p = new std::vector<float>(sexpsz);
-      double *S = NUMERIC_POINTER(obj);
-      for (unsigned pos = 0; pos < p->size(); pos++)
-        {
-          (*p)[pos] = static_cast<double>(S[pos]);
-        }
-      int res = SWIG_OK;
-      if (SWIG_IsOK(res)) {
-        if (val) *val = p;
-      }
-      return res;
-    }
-  };
-
-    // 8 bit integer types
-    template <>
-  struct traits_asptr < std::vector<unsigned char> > {
-    static int asptr(SEXP obj, std::vector<unsigned char> **val) {
-      std::vector<unsigned char> *p;
-      unsigned int sexpsz = Rf_length(obj);
-      p = new std::vector<unsigned char>(sexpsz);
-      SEXP coerced;
-      PROTECT(coerced = Rf_coerceVector(obj, INTSXP));
-      int *S = INTEGER_POINTER(coerced);
-      for (unsigned pos = 0; pos < p->size(); pos++)
-        {
-          (*p)[pos] = static_cast<unsigned char>(S[pos]);
-        }
-      int res = SWIG_OK;
-      if (SWIG_IsOK(res)) {
-        if (val) *val = p;
-      }
-      UNPROTECT(1);
-      return res;
-    }
-  };
-
-    template <>
-  struct traits_asptr < std::vector<signed char> > {
-    static int asptr(SEXP obj, std::vector<signed char> **val) {
-      std::vector<signed char> *p;
-      // not sure how to check the size of the SEXP obj is correct
-      int sexpsz = Rf_length(obj);
-      p = new std::vector<signed char>(sexpsz);
-      SEXP coerced;
-      PROTECT(coerced = Rf_coerceVector(obj, INTSXP));
-      int *S = INTEGER_POINTER(coerced);
-      for (unsigned pos = 0; pos < p->size(); pos++)
-        {
-          (*p)[pos] = static_cast<signed char>(S[pos]);
-        }
-      int res = SWIG_OK;
-      if (SWIG_IsOK(res)) {
-        if (val) *val = p;
-      }
-      UNPROTECT(1);
-      return res;
-    }
-  };
-
-   // 16 bit integer types
-    template <>
-  struct traits_asptr < std::vector<unsigned short int> > {
-    static int asptr(SEXP obj, std::vector<unsigned short int> **val) {
-      std::vector<unsigned short int> *p;
-      unsigned int sexpsz = Rf_length(obj);
-      p = new std::vector<unsigned short int>(sexpsz);
-      SEXP coerced;
-      PROTECT(coerced = Rf_coerceVector(obj, INTSXP));
-      int *S = INTEGER_POINTER(coerced);
-      for (unsigned pos = 0; pos < p->size(); pos++)
-        {
-          (*p)[pos] = static_cast<unsigned short int>(S[pos]);
-        }
-      int res = SWIG_OK;
-      if (SWIG_IsOK(res)) {
-        if (val) *val = p;
-      }
-      UNPROTECT(1);
-      return res;
-    }
-  };
-
-    template <>
-  struct traits_asptr < std::vector<short int> > {
-    static int asptr(SEXP obj, std::vector<short int> **val) {
-      std::vector<short int> *p;
-      // not sure how to check the size of the SEXP obj is correct
-      int sexpsz = Rf_length(obj);
-      p = new std::vector<short int>(sexpsz);
-      SEXP coerced;
-      PROTECT(coerced = Rf_coerceVector(obj, INTSXP));
-      int *S = INTEGER_POINTER(coerced);
-      for (unsigned pos = 0; pos < p->size(); pos++)
-        {
-          (*p)[pos] = static_cast<short int>(S[pos]);
-        }
-      int res = SWIG_OK;
-      if (SWIG_IsOK(res)) {
-        if (val) *val = p;
-      }
-      UNPROTECT(1);
-      return res;
-    }
-  };
-    // 32 bit integer types
-    template <>
-  struct traits_asptr < std::vector<unsigned int> > {
-    static int asptr(SEXP obj, std::vector<unsigned int> **val) {
-      std::vector<unsigned int> *p;
-      unsigned int sexpsz = Rf_length(obj);
-      p = new std::vector<unsigned int>(sexpsz);
-      SEXP coerced;
-      PROTECT(coerced = Rf_coerceVector(obj, INTSXP));
-      int *S = INTEGER_POINTER(coerced);
-      for (unsigned pos = 0; pos < p->size(); pos++)
-        {
-          (*p)[pos] = static_cast<unsigned int>(S[pos]);
-        }
-      int res = SWIG_OK;
-      if (SWIG_IsOK(res)) {
-        if (val) *val = p;
-      }
-      UNPROTECT(1);
-      return res;
-    }
-  };
-
-    template <>
-  struct traits_asptr < std::vector<int> > {
-    static int asptr(SEXP obj, std::vector<int> **val) {
-      std::vector<int> *p;
-      // not sure how to check the size of the SEXP obj is correct
-      int sexpsz = Rf_length(obj);
-      p = new std::vector<int>(sexpsz);
-      SEXP coerced;
-      PROTECT(coerced = Rf_coerceVector(obj, INTSXP));
-      int *S = INTEGER_POINTER(coerced);
-      for (unsigned pos = 0; pos < p->size(); pos++)
-        {
-          (*p)[pos] = static_cast<int>(S[pos]);
-        }
-      int res = SWIG_OK;
-      if (SWIG_IsOK(res)) {
-        if (val) *val = p;
-      }
-      UNPROTECT(1);
-      return res;
-    }
-  };
-
-#if defined(SWIGWORDSIZE64)
-    // 64 bit integer types
-    template <>
-  struct traits_asptr < std::vector<unsigned long int> > {
-    static int asptr(SEXP obj, std::vector<unsigned long int> **val) {
-      std::vector<unsigned long int> *p;
-      unsigned int sexpsz = Rf_length(obj);
-      p = new std::vector<unsigned long int>(sexpsz);
-      SEXP coerced;
-      PROTECT(coerced = Rf_coerceVector(obj, INTSXP));
-      int *S = INTEGER_POINTER(coerced);
-      for (unsigned pos = 0; pos < p->size(); pos++)
-        {
-          (*p)[pos] = static_cast<unsigned long int>(S[pos]);
-        }
-      int res = SWIG_OK;
-      if (SWIG_IsOK(res)) {
-        if (val) *val = p;
-      }
-      UNPROTECT(1);
-      return res;
-    }
-  };
-
-    template <>
-  struct traits_asptr < std::vector<long int> > {
-    static int asptr(SEXP obj, std::vector<long int> **val) {
-      std::vector<long int> *p;
-      // not sure how to check the size of the SEXP obj is correct
-      int sexpsz = Rf_length(obj);
-      p = new std::vector<long int>(sexpsz);
-      SEXP coerced;
-      PROTECT(coerced = Rf_coerceVector(obj, INTSXP));
-      int *S = INTEGER_POINTER(coerced);
-      for (unsigned pos = 0; pos < p->size(); pos++)
-        {
-          (*p)[pos] = static_cast<long int>(S[pos]);
-        }
-      int res = SWIG_OK;
-      if (SWIG_IsOK(res)) {
-        if (val) *val = p;
-      }
-      UNPROTECT(1);
-      return res;
-    }
-  };
-
-#else
-    // 64 bit integer types
-    template <>
-  struct traits_asptr < std::vector<unsigned long long int> > {
-    static int asptr(SEXP obj, std::vector<unsigned long long int> **val) {
-      std::vector<unsigned long long int> *p;
-      unsigned int sexpsz = Rf_length(obj);
-      p = new std::vector<unsigned long long int>(sexpsz);
-      SEXP coerced;
-      PROTECT(coerced = Rf_coerceVector(obj, INTSXP));
-      int *S = INTEGER_POINTER(coerced);
-      for (unsigned pos = 0; pos < p->size(); pos++)
-        {
-          (*p)[pos] = static_cast<unsigned long long int>(S[pos]);
-        }
-      int res = SWIG_OK;
-      if (SWIG_IsOK(res)) {
-        if (val) *val = p;
-      }
-      UNPROTECT(1);
-      return res;
-    }
-  };
-
-    template <>
-  struct traits_asptr < std::vector<long long int> > {
-    static int asptr(SEXP obj, std::vector<long long int> **val) {
-      std::vector<long long int> *p;
-      // not sure how to check the size of the SEXP obj is correct
-      int sexpsz = Rf_length(obj);
-      p = new std::vector<long long int>(sexpsz);
-      SEXP coerced;
-      PROTECT(coerced = Rf_coerceVector(obj, INTSXP));
-      int *S = INTEGER_POINTER(coerced);
-      for (unsigned pos = 0; pos < p->size(); pos++)
-        {
-          (*p)[pos] = static_cast<long long int>(S[pos]);
-        }
-      int res = SWIG_OK;
-      if (SWIG_IsOK(res)) {
-        if (val) *val = p;
-      }
-      UNPROTECT(1);
-      return res;
-    }
-  };
-
-#endif
 
     template <>
   struct traits_asptr < std::vector<bool> > {
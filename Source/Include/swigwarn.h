@@ -282,6 +282,8 @@
 #define WARN_CSHARP_EXCODE                    844
 #define WARN_CSHARP_CANTHROW                  845
 #define WARN_CSHARP_NO_DIRECTORCONNECT_ATTR   846
+#define WARN_CSHARP_BLITTABLE_MEMBER          847
+#define WARN_CSHARP_SUPPRESSGCTRANSITION      848
 
 /* please leave 830-849 free for C# */
 
@@ -306,6 +308,7 @@
 /* please leave 870-889 free for PHP */
 
 #define WARN_GO_NAME_CONFLICT                 890
+#define WARN_GO_BATCH                         891
 
 /* please leave 890-899 free for Go */
 
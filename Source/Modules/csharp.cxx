@@ -778,6 +778,7 @@ public:
     int num_arguments = 0;
     bool is_void_return;
     String *overloaded_name = getOverloadedName(n);
+    bool unsafe_pointers = unsafePointers(n);
 
     if (!Getattr(n, "sym:overloaded")) {
       if (!addSymbol(symname, n, imclass_name))
@@ -815,6 +816,7 @@ public:
       if (imtypeout)
 	tm = imtypeout;
       Printf(im_return_type, "%s", tm);
+      substituteClassname(t, im_return_type);
       im_outattributes = Getattr(n, "tmap:imtype:outattributes");
     } else {
       Swig_warning(WARN_CSHARP_TYPEMAP_CSTYPE_UNDEF, input_file, line_number, "No imtype typemap defined for %s\n", SwigType_str(t, 0));
@@ -848,6 +850,10 @@ public:
 
     Printv(imclass_class_code, "\n  [global::System.Runtime.InteropServices.DllImport(\"", dllimport, "\", EntryPoint=\"", wname, "\")]\n", NIL);
 
+    // Calls known not to block, call back into managed code or throw can skip the GC transition (.NET 5 or later)
+    if (GetFlag(n, "feature:cs:suppressgctransition"))
+      Printf(imclass_class_code, "  [global::System.Runtime.InteropServices.SuppressGCTransition]\n");
+
     if (im_outattributes)
       Printf(imclass_class_code, "  %s\n", im_outattributes);
 
@@ -883,7 +889,11 @@ public:
       /* Get the intermediary class parameter types of the parameter */
       if ((tm = Getattr(p, "tmap:imtype"))) {
 	const String *inattributes = Getattr(p, "tmap:imtype:inattributes");
-	Printf(im_param_type, "%s%s", inattributes ? inattributes : empty_string, tm);
+	if (unsafe_pointers && isHandleRef(tm))
+	  Printf(im_param_type, "%sglobal::System.IntPtr", inattributes ? inattributes : empty_string);
+	else
+	  Printf(im_param_type, "%s%s", inattributes ? inattributes : empty_string, tm);
+	substituteClassname(pt, im_param_type);
       } else {
 	Swig_warning(WARN_CSHARP_TYPEMAP_CSTYPE_UNDEF, input_file, line_number, "No imtype typemap defined for %s\n", SwigType_str(pt, 0));
       }
@@ -979,9 +989,20 @@ public:
       Swig_director_emit_dynamic_cast(n, f);
       String *actioncode = emit_action(n);
 
-      /* Return value if necessary  */
-      if ((tm = Swig_typemap_lookup_out("out", n, Swig_cresult_name(), f, actioncode))) {
-	canThrow(n, "out", n);
+      /* Return value if necessary, variable getters use the varout typemap in preference to the out typemap */
+      const char *out_method = "varout";
+      tm = 0;
+      if (GetFlag(n, "memberget") || GetFlag(n, "varget")) {
+	tm = Swig_typemap_lookup(out_method, n, Swig_cresult_name(), f);
+	if (tm)
+	  Append(f->code, actioncode);
+      }
+      if (!tm) {
+	out_method = "out";
+	tm = Swig_typemap_lookup_out(out_method, n, Swig_cresult_name(), f, actioncode);
+      }
+      if (tm) {
+	canThrow(n, out_method, n);
 	Replaceall(tm, "$source", Swig_cresult_name());	/* deprecated */
 	Replaceall(tm, "$target", "jresult");	/* deprecated */
 	Replaceall(tm, "$result", "jresult");
@@ -992,7 +1013,7 @@ public:
           Replaceall(tm, "$owner", "0");
 
 	Printf(f->code, "%s", tm);
-	null_attribute = Getattr(n, "tmap:out:null");
+	null_attribute = Getattr(n, Equal(out_method, "varout") ? "tmap:varout:null" : "tmap:out:null");
 	if (Len(tm))
 	  Printf(f->code, "\n");
       } else {
@@ -1072,6 +1093,14 @@ public:
 		       "Unmanaged code contains a call to a SWIG_CSharpSetPendingException method and C# code does not handle pending exceptions via the canthrow attribute.\n");
 	}
       }
+
+      // Calling back into the runtime, such as for exceptions or returning strings, is not permitted when the GC transition is suppressed
+      if (GetFlag(n, "feature:cs:suppressgctransition")) {
+	if (Getattr(n, "csharp:canthrow") || Strstr(f->code, "SWIG_CSharpSetPendingException") || Strstr(f->code, "SWIG_csharp_string_callback")) {
+	  Swig_warning(WARN_CSHARP_SUPPRESSGCTRANSITION, input_file, line_number,
+		       "Unmanaged code for %s calls back into the managed runtime, the cs:suppressgctransition feature should not be used.\n", overloaded_name);
+	}
+      }
     }
 
     if (!(proxy_flag && is_wrapping_class()) && !enum_constant_flag) {
@@ -2056,11 +2085,186 @@ public:
     }
   }
 
+  /* -----------------------------------------------------------------------------
+   * blittableFieldType()
+   *
+   * Return the C# type for a member variable of a struct marked with the
+   * cs:blittable feature or NULL if the C type has no fixed size blittable
+   * C# equivalent. C long and bool are rejected as their size varies by platform.
+   * ----------------------------------------------------------------------------- */
+
+  String *blittableFieldType(SwigType *t) {
+    String *cstype = NULL;
+    SwigType *type = SwigType_typedef_resolve_all(t);
+    SwigType *strippedtype = SwigType_strip_qualifiers(type);
+
+    if (SwigType_ispointer(strippedtype)) {
+      cstype = NewString("global::System.IntPtr");
+    } else if (SwigType_isenum(strippedtype)) {
+      cstype = NewString("int");
+    } else {
+      switch (SwigType_type(strippedtype)) {
+      case T_SCHAR:
+	cstype = NewString("sbyte");
+	break;
+      case T_UCHAR:
+	cstype = NewString("byte");
+	break;
+      case T_SHORT:
+	cstype = NewString("short");
+	break;
+      case T_USHORT:
+	cstype = NewString("ushort");
+	break;
+      case T_INT:
+	cstype = NewString("int");
+	break;
+      case T_UINT:
+	cstype = NewString("uint");
+	break;
+      case T_LONGLONG:
+	cstype = NewString("long");
+	break;
+      case T_ULONGLONG:
+	cstype = NewString("ulong");
+	break;
+      case T_FLOAT:
+	cstype = NewString("float");
+	break;
+      case T_DOUBLE:
+	cstype = NewString("double");
+	break;
+      case T_USER:
+	{
+	  Node *cls = classLookup(strippedtype);
+	  if (cls && GetFlag(cls, "feature:cs:blittable"))
+	    cstype = Copy(getProxyName(strippedtype));
+	}
+	break;
+      default:
+	break;
+      }
+    }
+
+    Delete(strippedtype);
+    Delete(type);
+    return cstype;
+  }
+
+  /* -----------------------------------------------------------------------------
+   * blittableStructHandler()
+   *
+   * Classes marked with the cs:blittable feature are POD structs which are
+   * generated as a C# value type with sequential layout instead of a proxy
+   * class holding a pointer to C++ memory. The fields are laid out to match
+   * the C struct so P/Invoke can pass them and arrays of them without copying.
+   * No wrappers are generated for the members, they are accessed directly.
+   * ----------------------------------------------------------------------------- */
+
+  int blittableStructHandler(Node *n) {
+    String *nspace = getNSpace();
+    String *symname = Getattr(n, "sym:name");
+    SwigType *typemap_lookup_type = Getattr(n, "classtypeobj");
+    bool has_outerclass = Getattr(n, "nested:outer") && !GetFlag(n, "feature:flatnested");
+
+    if (Getattr(n, "bases")) {
+      Swig_error(Getfile(n), Getline(n), "Blittable struct %s cannot have base classes.\n", SwigType_namestr(typemap_lookup_type));
+      return SWIG_ERROR;
+    }
+
+    String *fields_code = NewString("");
+    for (Node *c = firstChild(n); c; c = nextSibling(c)) {
+      String *nodetype = nodeType(c);
+      if (Equal(nodetype, "access") || Equal(nodetype, "classforward") || Equal(nodetype, "insert"))
+	continue;
+      bool is_field = Equal(nodetype, "cdecl") && Equal(Getattr(c, "kind"), "variable") && !Equal(Getattr(c, "storage"), "static");
+      if (Equal(Getattr(c, "storage"), "virtual")) {
+	Swig_error(Getfile(c), Getline(c), "Blittable struct %s cannot have virtual methods.\n", SwigType_namestr(typemap_lookup_type));
+	Delete(fields_code);
+	return SWIG_ERROR;
+      }
+      if (!is_field) {
+	if (!GetFlag(c, "feature:ignore") && !Equal(nodetype, "destructor") && !GetFlag(c, "default_constructor"))
+	  Swig_warning(WARN_CSHARP_BLITTABLE_MEMBER, Getfile(c), Getline(c), "Member %s of blittable struct %s is not wrapped. Only member variables are accessible from C#.\n",
+		       Getattr(c, "name"), SwigType_namestr(typemap_lookup_type));
+	continue;
+      }
+      SwigType *fieldtype = Getattr(c, "type");
+      String *cstype = Getattr(c, "bitfield") || SwigType_isarray(fieldtype) ? 0 : blittableFieldType(fieldtype);
+      if (!cstype) {
+	Swig_error(Getfile(c), Getline(c), "Member variable %s of type %s cannot be mapped into blittable struct %s.\n",
+		   Getattr(c, "name"), SwigType_str(fieldtype, 0), SwigType_namestr(typemap_lookup_type));
+	Delete(fields_code);
+	return SWIG_ERROR;
+      }
+      // Non-public and ignored fields are still required to get the correct struct layout
+      bool is_public = !Getattr(c, "access") || Equal(Getattr(c, "access"), "public");
+      String *fieldname = Getattr(c, "sym:name") ? Getattr(c, "sym:name") : Getattr(c, "name");
+      Printf(fields_code, "  %s %s %s;\n", is_public && !GetFlag(c, "feature:ignore") ? "public" : "private", cstype, fieldname);
+      Delete(cstype);
+    }
+
+    if (Node *outer = Getattr(n, "nested:outer")) {
+      String *outerClassesPrefix = Copy(Getattr(outer, "sym:name"));
+      for (outer = Getattr(outer, "nested:outer"); outer != 0; outer = Getattr(outer, "nested:outer")) {
+	Push(outerClassesPrefix, ".");
+	Push(outerClassesPrefix, Getattr(outer, "sym:name"));
+      }
+      String *fnspace = nspace ? NewStringf("%s.%s", nspace, outerClassesPrefix) : Copy(outerClassesPrefix);
+      bool added = addSymbol(symname, n, fnspace) ? true : false;
+      Delete(fnspace);
+      Delete(outerClassesPrefix);
+      if (!added) {
+	Delete(fields_code);
+	return SWIG_ERROR;
+      }
+    } else if (!addSymbol(symname, n, nspace)) {
+      Delete(fields_code);
+      return SWIG_ERROR;
+    }
+
+    String *struct_code = NewString("");
+    if (!has_outerclass)
+      Printv(struct_code, typemapLookup(n, "csimports", typemap_lookup_type, WARN_NONE), "\n", NIL);
+    const String *csattributes = typemapLookup(n, "csattributes", typemap_lookup_type, WARN_NONE);
+    if (csattributes && *Char(csattributes))
+      Printf(struct_code, "%s\n", csattributes);
+    Printv(struct_code, "[global::System.Runtime.InteropServices.StructLayout(global::System.Runtime.InteropServices.LayoutKind.Sequential)]\n",
+	   typemapLookup(n, "csclassmodifiers", typemap_lookup_type, WARN_CSHARP_TYPEMAP_CLASSMOD_UNDEF), " ", symname, " {\n", fields_code,
+	   typemapLookup(n, "cscode", typemap_lookup_type, WARN_NONE), NIL);
+    Replaceall(struct_code, "$csclassname", symname);
+    Replaceall(struct_code, "$module", module_class_name);
+    Replaceall(struct_code, "$imclassname", imclass_name);
+    Replaceall(struct_code, "$dllimport", dllimport);
+
+    if (!has_outerclass) {
+      String *output_directory = outputDirectory(nspace);
+      File *f_struct = getOutputFile(output_directory, symname);
+      addOpenNamespace(nspace, f_struct);
+      Printv(f_struct, struct_code, "}\n", NIL);
+      addCloseNamespace(nspace, f_struct);
+      if (f_struct != f_single_out)
+	Delete(f_struct);
+      Delete(output_directory);
+    } else {
+      Append(struct_code, "}\n\n");
+      Swig_offset_string(struct_code, nesting_depth + 1);
+      Append(proxy_class_code, struct_code);
+    }
+
+    Delete(struct_code);
+    Delete(fields_code);
+    return SWIG_OK;
+  }
+
   /* ----------------------------------------------------------------------
    * classHandler()
    * ---------------------------------------------------------------------- */
 
   virtual int classHandler(Node *n) {
+    if (proxy_flag && GetFlag(n, "feature:cs:blittable"))
+      return blittableStructHandler(n);
+
     String *nspace = getNSpace();
     File *f_proxy = NULL;
     File *f_interface = NULL;
@@ -2277,6 +2481,80 @@ public:
   }
 
 
+  /* -----------------------------------------------------------------------------
+   * unsafePointers()
+   *
+   * True if the cs:unsafepointers feature is set, then parameters passed to the
+   * intermediary class as a HandleRef are passed as a blittable IntPtr instead.
+   * The proxy passes the IntPtr from the HandleRef and keeps the proxy object alive
+   * until the call returns. Not used for destructors as they are called with swigCPtr.
+   * ----------------------------------------------------------------------------- */
+
+  bool unsafePointers(Node *n) {
+    return GetFlag(n, "feature:cs:unsafepointers") && !Equal(nodeType(n), "destructor");
+  }
+
+  static bool isHandleRef(const String *imtype) {
+    return Equal(imtype, "global::System.Runtime.InteropServices.HandleRef");
+  }
+
+  /* -----------------------------------------------------------------------------
+   * unsafePointerArgument()
+   *
+   * Add the IntPtr argument for a HandleRef to the intermediary class call and the
+   * code to keep the object alive until the call returns to keepalive_code.
+   * ----------------------------------------------------------------------------- */
+
+  void unsafePointerArgument(String *imcall, const String *handleref, const String *object, String *keepalive_code) {
+    Printv(imcall, handleref, ".Handle", NIL);
+    if (Len(keepalive_code) > 0)
+      Printf(keepalive_code, "\n");
+    Printf(keepalive_code, "      global::System.GC.KeepAlive(%s);", object);
+  }
+
+  /* -----------------------------------------------------------------------------
+   * unsafePointerAccessor()
+   *
+   * Wrap the body of a property get or set accessor from the csvarout or csvarin
+   * typemap in a try block with the code keeping the objects alive in its finally block.
+   * ----------------------------------------------------------------------------- */
+
+  void unsafePointerAccessor(String *tm, const String *keepalive_code) {
+    if (Len(keepalive_code) == 0)
+      return;
+    const char *code = Char(tm);
+    const char *start = strchr(code, '{');
+    const char *end = strrchr(code, '}');
+    if (!start || !end || end < start)
+      return;
+    String *body = NewStringWithSize(start + 1, (int)(end - start - 1));
+    Chop(body);
+    Replaceall(body, "\n", "\n  ");
+    String *finally_code = Copy(keepalive_code);
+    Replaceall(finally_code, "      ", "        ");
+    String *accessor = NewStringWithSize(code, (int)(start - code + 1));
+    Printv(accessor, "\n      try {", body, "\n      } finally {\n", finally_code, "\n      }\n    }", end + 1, NIL);
+    Clear(tm);
+    Append(tm, accessor);
+    Delete(accessor);
+    Delete(finally_code);
+    Delete(body);
+  }
+
+  /* -----------------------------------------------------------------------------
+   * appendKeepAlive()
+   *
+   * Add the code keeping the objects passed as an IntPtr alive to the post code.
+   * ----------------------------------------------------------------------------- */
+
+  void appendKeepAlive(String *post_code, const String *keepalive_code) {
+    if (Len(keepalive_code) > 0) {
+      if (Len(post_code) > 0)
+	Printf(post_code, "\n");
+      Append(post_code, keepalive_code);
+    }
+  }
+
   /* -----------------------------------------------------------------------------
    * proxyClassFunctionHandler()
    *
@@ -2303,6 +2581,7 @@ public:
     bool setter_flag = false;
     String *pre_code = NewString("");
     String *post_code = NewString("");
+    String *keepalive_code = NewString("");
     String *terminator_code = NewString("");
     bool is_interface = Getattr(parentNode(n), "feature:interface") != 0 
       && !static_flag && Getattr(n, "interface:owner") == 0;
@@ -2328,6 +2607,9 @@ public:
     Swig_typemap_attach_parms("in", l, NULL);
     Swig_typemap_attach_parms("cstype", l, NULL);
     Swig_typemap_attach_parms("csin", l, NULL);
+    bool unsafe_pointers = unsafePointers(n);
+    if (unsafe_pointers)
+      Swig_typemap_attach_parms("imtype", l, NULL);
 
     /* Get return types */
     if ((tm = Swig_typemap_lookup("cstype", n, "", 0))) {
@@ -2394,8 +2676,12 @@ public:
     
 
     Printv(imcall, full_imclass_name, ".$imfuncname(", NIL);
-    if (!static_flag)
-      Printf(imcall, "swigCPtr");
+    if (!static_flag) {
+      if (unsafe_pointers)
+	unsafePointerArgument(imcall, "swigCPtr", "this", keepalive_code);
+      else
+	Printf(imcall, "swigCPtr");
+    }
 
     emit_mark_varargs(l);
 
@@ -2465,7 +2751,10 @@ public:
               Insert(terminator_code, 0, "\n");
             Insert(terminator_code, 0, terminator);
           }
-	  Printv(imcall, tm, NIL);
+	  if (unsafe_pointers && isHandleRef(Getattr(p, "tmap:imtype")))
+	    unsafePointerArgument(imcall, tm, arg, keepalive_code);
+	  else
+	    Printv(imcall, tm, NIL);
 	} else {
 	  Swig_warning(WARN_CSHARP_TYPEMAP_CSIN_UNDEF, input_file, line_number, "No csin typemap defined for %s\n", SwigType_str(pt, 0));
 	}
@@ -2489,6 +2778,8 @@ public:
 
     Printf(imcall, ")");
     Printf(function_code, ")");
+    if (!(wrapping_member_flag && !enum_constant_flag))
+      appendKeepAlive(post_code, keepalive_code);
     if (is_interface)
       Printf(interface_class_code, ");\n");
 
@@ -2598,6 +2889,7 @@ public:
 	  Replaceall(tm, "$csinput", "value");
 	  Replaceall(tm, "$imcall", imcall);
 	  excodeSubstitute(n, tm, "csvarin", variable_parm);
+	  unsafePointerAccessor(tm, keepalive_code);
 	  Printf(proxy_class_code, "%s", tm);
 	} else {
 	  Swig_warning(WARN_CSHARP_TYPEMAP_CSOUT_UNDEF, input_file, line_number, "No csvarin typemap defined for %s\n", SwigType_str(cvariable_type, 0));
@@ -2612,6 +2904,7 @@ public:
 	  substituteClassname(t, tm);
 	  Replaceall(tm, "$imcall", imcall);
 	  excodeSubstitute(n, tm, "csvarout", n);
+	  unsafePointerAccessor(tm, keepalive_code);
 	  Printf(proxy_class_code, "%s", tm);
 	} else {
 	  Swig_warning(WARN_CSHARP_TYPEMAP_CSOUT_UNDEF, input_file, line_number, "No csvarout typemap defined for %s\n", SwigType_str(t, 0));
@@ -2625,6 +2918,7 @@ public:
 
     Delete(pre_code);
     Delete(post_code);
+    Delete(keepalive_code);
     Delete(terminator_code);
     Delete(function_code);
     Delete(return_type);
@@ -2684,6 +2978,9 @@ public:
       Swig_typemap_attach_parms("in", l, NULL);
       Swig_typemap_attach_parms("cstype", l, NULL);
       Swig_typemap_attach_parms("csin", l, NULL);
+      bool unsafe_pointers = unsafePointers(n);
+      if (unsafe_pointers)
+	Swig_typemap_attach_parms("imtype", l, NULL);
 
       emit_mark_varargs(l);
 
@@ -2753,7 +3050,10 @@ public:
           cshin = Getattr(p, "tmap:csin:cshin");
           if (cshin)
             Replaceall(cshin, "$csinput", arg);
-	  Printv(imcall, tm, NIL);
+	  if (unsafe_pointers && isHandleRef(Getattr(p, "tmap:imtype")))
+	    unsafePointerArgument(imcall, tm, arg, post_code);
+	  else
+	    Printv(imcall, tm, NIL);
 	} else {
 	  Swig_warning(WARN_CSHARP_TYPEMAP_CSIN_UNDEF, input_file, line_number, "No csin typemap defined for %s\n", SwigType_str(pt, 0));
 	}
@@ -2957,6 +3257,7 @@ public:
     bool setter_flag = false;
     String *pre_code = NewString("");
     String *post_code = NewString("");
+    String *keepalive_code = NewString("");
     String *terminator_code = NewString("");
 
     if (l) {
@@ -2968,6 +3269,9 @@ public:
     /* Attach the non-standard typemaps to the parameter list */
     Swig_typemap_attach_parms("cstype", l, NULL);
     Swig_typemap_attach_parms("csin", l, NULL);
+    bool unsafe_pointers = unsafePointers(n);
+    if (unsafe_pointers)
+      Swig_typemap_attach_parms("imtype", l, NULL);
 
     /* Get return types */
     if ((tm = Swig_typemap_lookup("cstype", n, "", 0))) {
@@ -3069,7 +3373,10 @@ public:
             Insert(terminator_code, 0, "\n");
           Insert(terminator_code, 0, terminator);
         }
-	Printv(imcall, tm, NIL);
+	if (unsafe_pointers && isHandleRef(Getattr(p, "tmap:imtype")))
+	  unsafePointerArgument(imcall, tm, arg, keepalive_code);
+	else
+	  Printv(imcall, tm, NIL);
       } else {
 	Swig_warning(WARN_CSHARP_TYPEMAP_CSIN_UNDEF, input_file, line_number, "No csin typemap defined for %s\n", SwigType_str(pt, 0));
       }
@@ -3087,6 +3394,8 @@ public:
 
     Printf(imcall, ")");
     Printf(function_code, ")");
+    if (!(proxy_flag && global_variable_flag))
+      appendKeepAlive(post_code, keepalive_code);
 
     // Transform return type used in PInvoke function (in intermediary class) to type used in C# wrapper function (in module class)
     if ((tm = Swig_typemap_lookup("csout", n, "", 0))) {
@@ -3157,6 +3466,7 @@ public:
 	  Replaceall(tm, "$csinput", "value");
 	  Replaceall(tm, "$imcall", imcall);
 	  excodeSubstitute(n, tm, "csvarin", p);
+	  unsafePointerAccessor(tm, keepalive_code);
 	  Printf(module_class_code, "%s", tm);
 	} else {
 	  Swig_warning(WARN_CSHARP_TYPEMAP_CSOUT_UNDEF, input_file, line_number, "No csvarin typemap defined for %s\n", SwigType_str(pt, 0));
@@ -3171,6 +3481,7 @@ public:
 	  substituteClassname(t, tm);
 	  Replaceall(tm, "$imcall", imcall);
 	  excodeSubstitute(n, tm, "csvarout", n);
+	  unsafePointerAccessor(tm, keepalive_code);
 	  Printf(module_class_code, "%s", tm);
 	} else {
 	  Swig_warning(WARN_CSHARP_TYPEMAP_CSOUT_UNDEF, input_file, line_number, "No csvarout typemap defined for %s\n", SwigType_str(t, 0));
@@ -3184,6 +3495,7 @@ public:
 
     Delete(pre_code);
     Delete(post_code);
+    Delete(keepalive_code);
     Delete(terminator_code);
     Delete(function_code);
     Delete(return_type);
@@ -932,6 +932,18 @@ private:
       return r;
     }
 
+    if (GetFlag(n, "feature:go:batch")) {
+      if (overname || is_ctor_dtor || (class_name && !is_static) || emit_num_arguments(parms) != emit_num_required(parms)) {
+	if (!Getattr(n, "sym:nextSibling"))
+	  Swig_warning(WARN_GO_BATCH, input_file, line_number, "%%feature(\"go:batch\") ignored for %s, only non-overloaded functions and static member functions without default arguments are supported.\n", go_name);
+      } else {
+	r = makeBatchWrappers(n, go_name, wname, parms, result);
+	if (r != SWIG_OK) {
+	  return r;
+	}
+      }
+    }
+
     if (Getattr(n, "sym:overloaded") && !Getattr(n, "sym:nextSibling")) {
       String *scope ;
       if (!class_name || is_static || is_ctor_dtor) {
@@ -1037,6 +1049,233 @@ private:
     return ret;
   }
 
+  /* ----------------------------------------------------------------------
+   * makeBatchWrappers()
+   *
+   * Write out the batch wrapper requested by %feature("go:batch").
+   * For a function F this writes a Go struct FBatchArgs holding one
+   * set of arguments and a Go function FBatch taking a slice of them
+   * and returning a slice of results.  When using cgo and all the
+   * parameters and the result are plain numeric types, FBatch makes
+   * a single call to a C function which loops over the arguments, so
+   * that only one cgo transition is made for the whole slice.
+   * Otherwise FBatch simply calls F for each element.
+   * ---------------------------------------------------------------------- */
+
+  int makeBatchWrappers(Node *n, String *go_name, String *wname, ParmList *parms, SwigType *result) {
+    String *batch_name = NewStringf("%sBatch", go_name);
+    String *args_name = NewStringf("%sBatchArgs", go_name);
+    if (!checkNameConflict(batch_name, n, NULL) || !checkNameConflict(args_name, n, NULL)) {
+      Delete(batch_name);
+      Delete(args_name);
+      return SWIG_OK;
+    }
+
+    Swig_save("makeBatchWrappers", n, "type", "tmap:goout", "emit:cgotype", "emit:cgotypestruct", NULL);
+
+    Wrapper *dummy = initGoTypemaps(parms);
+
+    bool is_void = SwigType_type(result) == T_VOID;
+    bool single_call = cgo_flag;
+
+    // The Go struct holding the arguments of one call.
+
+    int parm_count = emit_num_arguments(parms);
+    List *fields = NewList();
+    Printv(f_go_wrappers, "type ", args_name, " struct {\n", NULL);
+    Parm *p = parms;
+    for (int i = 0; i < parm_count; ++i) {
+      p = getParm(p);
+      SwigType *pt = Getattr(p, "type");
+      String *pn = Getattr(p, "name");
+      String *field = NULL;
+      if (pn && Len(pn) > 0) {
+	field = exportedName(pn);
+	for (Iterator fi = First(fields); fi.item; fi = Next(fi)) {
+	  if (Equal(fi.item, field)) {
+	    Delete(field);
+	    field = NULL;
+	    break;
+	  }
+	}
+      }
+      if (!field) {
+	field = NewStringf("Arg%d", i + 1);
+      }
+      Append(fields, field);
+
+      String *tm = goType(p, pt);
+      Printv(f_go_wrappers, "\t", field, " ", tm, "\n", NULL);
+      Delete(tm);
+
+      if (single_call && (goGetattr(p, "tmap:goin") || goGetattr(p, "tmap:goargout") || !isBatchScalar(p, pt))) {
+	single_call = false;
+      }
+
+      Delete(field);
+      p = nextParm(p);
+    }
+    Printv(f_go_wrappers, "}\n\n", NULL);
+
+    String *ret_type = NULL;
+    if (!is_void) {
+      Setattr(n, "type", result);
+      ret_type = goType(n, result);
+      if (single_call && (goTypemapLookup("goout", n, "swig_r") || !isBatchScalar(n, result))) {
+	single_call = false;
+      }
+    }
+
+    if (cgo_flag && !single_call) {
+      Swig_warning(WARN_GO_BATCH, input_file, line_number, "%%feature(\"go:batch\") for %s calls %s once per element, only numeric parameter and result types can be passed in a single call.\n", go_name, go_name);
+    }
+
+    // The Go batch function.
+
+    Printv(f_go_wrappers, "func ", batch_name, "(args []", args_name, ")", NULL);
+    if (!is_void) {
+      Printv(f_go_wrappers, " (_swig_ret []", ret_type, ")", NULL);
+    }
+    Printv(f_go_wrappers, " {\n", NULL);
+    if (!is_void) {
+      Printv(f_go_wrappers, "\t_swig_ret = make([]", ret_type, ", len(args))\n", NULL);
+    }
+
+    if (single_call) {
+      Printv(f_go_wrappers, "\tif len(args) > 0 {\n", NULL);
+      Printv(f_go_wrappers, "\t\tC.", wname, "_batch(C.swig_intgo(len(args)), unsafe.Pointer(&args[0]), ", NULL);
+      if (is_void) {
+	Printv(f_go_wrappers, "nil", NULL);
+      } else {
+	Printv(f_go_wrappers, "unsafe.Pointer(&_swig_ret[0])", NULL);
+      }
+      Printv(f_go_wrappers, ")\n", NULL);
+      Printv(f_go_wrappers, "\t}\n", NULL);
+    } else {
+      Printv(f_go_wrappers, "\tfor i := range args {\n\t\t", NULL);
+      if (!is_void) {
+	Printv(f_go_wrappers, "_swig_ret[i] = ", NULL);
+      }
+      Printv(f_go_wrappers, go_name, "(", NULL);
+      for (int i = 0; i < parm_count; ++i) {
+	if (i > 0) {
+	  Printv(f_go_wrappers, ", ", NULL);
+	}
+	Printv(f_go_wrappers, "args[i].", Getitem(fields, i), NULL);
+      }
+      Printv(f_go_wrappers, ")\n", NULL);
+      Printv(f_go_wrappers, "\t}\n", NULL);
+    }
+
+    if (!is_void) {
+      Printv(f_go_wrappers, "\treturn\n", NULL);
+    }
+    Printv(f_go_wrappers, "}\n\n", NULL);
+
+    // The C function looping over the arguments.  It calls the
+    // regular C wrapper, whose parameters have the same C types as
+    // the fields of the Go struct.
+
+    if (single_call) {
+      Printv(f_cgo_comment, "extern void ", wname, "_batch(intgo _swig_n, void *_swig_args, void *_swig_results);\n", NULL);
+
+      Printv(f_c_wrappers, "void ", wname, "_batch(intgo _swig_n, void *_swig_args, void *_swig_results) {\n", NULL);
+      if (parm_count > 0) {
+	Printv(f_c_wrappers, "  struct swig_batch_args {\n", NULL);
+	p = parms;
+	for (int i = 0; i < parm_count; ++i) {
+	  p = getParm(p);
+	  String *ln = NewStringf("_swig_go_%d", i);
+	  String *ct = gcCTypeForGoValue(p, Getattr(p, "type"), ln);
+	  Printv(f_c_wrappers, "    ", ct, ";\n", NULL);
+	  Delete(ct);
+	  Delete(ln);
+	  p = nextParm(p);
+	}
+	Printv(f_c_wrappers, "  } *_swig_a = (struct swig_batch_args *)_swig_args;\n", NULL);
+      }
+      if (!is_void) {
+	String *ln = NewString("*_swig_r");
+	String *ct = gcCTypeForGoValue(n, result, ln);
+	Printv(f_c_wrappers, "  ", ct, " = (", NULL);
+	Delete(ct);
+	Delete(ln);
+	ln = NewString("*");
+	ct = gcCTypeForGoValue(n, result, ln);
+	Printv(f_c_wrappers, ct, ")_swig_results;\n", NULL);
+	Delete(ct);
+	Delete(ln);
+      } else {
+	Printv(f_c_wrappers, "  (void)_swig_results;\n", NULL);
+      }
+      Printv(f_c_wrappers, "  intgo _swig_i;\n", NULL);
+      Printv(f_c_wrappers, "  for (_swig_i = 0; _swig_i < _swig_n; ++_swig_i) {\n    ", NULL);
+      if (!is_void) {
+	Printv(f_c_wrappers, "_swig_r[_swig_i] = ", NULL);
+      }
+      Printv(f_c_wrappers, wname, "(", NULL);
+      for (int i = 0; i < parm_count; ++i) {
+	if (i > 0) {
+	  Printv(f_c_wrappers, ", ", NULL);
+	}
+	Printf(f_c_wrappers, "_swig_a[_swig_i]._swig_go_%d", i);
+      }
+      Printv(f_c_wrappers, ");\n", NULL);
+      Printv(f_c_wrappers, "  }\n", NULL);
+      Printv(f_c_wrappers, "}\n\n", NULL);
+    }
+
+    Swig_restore(n);
+
+    Delete(ret_type);
+    Delete(fields);
+    Delete(batch_name);
+    Delete(args_name);
+    DelWrapper(dummy);
+
+    return SWIG_OK;
+  }
+
+  /* ----------------------------------------------------------------------
+   * isBatchScalar()
+   *
+   * Return whether a value of this type is passed to the cgo wrapper
+   * as a plain numeric type whose Go and C layouts match, so that it
+   * may be stored in a struct shared by Go and C.
+   * ---------------------------------------------------------------------- */
+
+  bool isBatchScalar(Node *n, SwigType *type) {
+    static const char *const scalars[] = {
+      "bool", "int", "uint", "int8", "uint8", "byte", "int16", "uint16", "int32", "uint32", "rune",
+      "int64", "uint64", "float32", "float64", "uintptr", NULL
+    };
+
+    if (goTypeIsInterface(n, type)) {
+      return false;
+    }
+
+    bool c_struct_type;
+    Delete(cgoTypeForGoValue(n, type, &c_struct_type));
+    if (c_struct_type) {
+      return false;
+    }
+
+    String *gt = goType(n, type);
+    String *it = goImType(n, type);
+    bool ret = false;
+    if (Equal(gt, it)) {
+      for (int i = 0; scalars[i]; ++i) {
+	if (Strcmp(it, scalars[i]) == 0) {
+	  ret = true;
+	  break;
+	}
+      }
+    }
+    Delete(gt);
+    Delete(it);
+    return ret;
+  }
+
   /* ----------------------------------------------------------------------
    * struct cgoWrapperInfo
    *
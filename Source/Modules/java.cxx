@@ -38,6 +38,7 @@ class JAVA:public Language {
 
   bool proxy_flag;		// Flag for generating proxy classes
   bool nopgcpp_flag;		// Flag for suppressing the premature garbage collection prevention parameter
+  bool ffm_flag;		// Flag for calling plain C wrappers via the foreign function and memory API where possible
   bool native_function_flag;	// Flag for when wrapping a native function
   bool enum_constant_flag;	// Flag for when wrapping an enum or constant
   bool static_flag;		// Flag for when wrapping a static functions or member variables
@@ -77,6 +78,7 @@ class JAVA:public Language {
   String *upcasts_code;		//C++ casts for inheritance hierarchies C++ code
   String *imclass_cppcasts_code;	//C++ casts up inheritance hierarchies intermediary class code
   String *imclass_directors;	// Intermediate class director code
+  String *imclass_ffm_handles;	// Intermediate class downcall method handles for the foreign function and memory API
   String *destructor_call;	//C++ destructor call if any
   String *destructor_throws_clause;	//C++ destructor throws clause if any
 
@@ -112,6 +114,7 @@ public:
       filenames_list(NULL),
       proxy_flag(true),
       nopgcpp_flag(false),
+      ffm_flag(false),
       native_function_flag(false),
       enum_constant_flag(false),
       static_flag(false),
@@ -150,6 +153,7 @@ public:
       upcasts_code(NULL),
       imclass_cppcasts_code(NULL),
       imclass_directors(NULL),
+      imclass_ffm_handles(NULL),
       destructor_call(NULL),
       destructor_throws_clause(NULL),
       dmethods_seq(NULL),
@@ -283,6 +287,9 @@ public:
 	} else if (strcmp(argv[i], "-nopgcpp") == 0) {
 	  Swig_mark_arg(i);
 	  nopgcpp_flag = true;
+	} else if (strcmp(argv[i], "-ffm") == 0) {
+	  Swig_mark_arg(i);
+	  ffm_flag = true;
 	} else if (strcmp(argv[i], "-oldvarnames") == 0) {
 	  Swig_mark_arg(i);
 	  old_variable_names = true;
@@ -422,6 +429,7 @@ public:
     imclass_imports = NewString("");
     imclass_cppcasts_code = NewString("");
     imclass_directors = NewString("");
+    imclass_ffm_handles = NewString("");
     upcasts_code = NewString("");
     dmethods_seq = NewList();
     dmethods_table = NewHash();
@@ -534,6 +542,25 @@ public:
       if (Len(imclass_directors) > 0)
 	Printv(f_im, "\n", imclass_directors, NIL);
 
+      if (Len(imclass_ffm_handles) > 0) {
+	// Holder class so that the symbols are looked up on first use, after the native library has been loaded
+	Printf(f_im, "\n  private final static class SwigFFM {\n");
+	Printf(f_im, "    private final static java.lang.foreign.Linker LINKER = java.lang.foreign.Linker.nativeLinker();\n");
+	Printf(f_im, "    private final static java.lang.foreign.SymbolLookup LOOKUP = java.lang.foreign.SymbolLookup.loaderLookup();\n\n");
+	Printf(f_im, "    private static java.lang.invoke.MethodHandle downcall(String name, java.lang.foreign.FunctionDescriptor descriptor) {\n");
+	Printf(f_im, "      return LINKER.downcallHandle(LOOKUP.find(name).orElseThrow(() -> new UnsatisfiedLinkError(\"Unable to find native symbol \" + name)), descriptor);\n");
+	Printf(f_im, "    }\n\n");
+	Printf(f_im, "    static RuntimeException rethrow(Throwable t) {\n");
+	Printf(f_im, "      if (t instanceof RuntimeException)\n");
+	Printf(f_im, "        return (RuntimeException)t;\n");
+	Printf(f_im, "      if (t instanceof Error)\n");
+	Printf(f_im, "        throw (Error)t;\n");
+	Printf(f_im, "      return new RuntimeException(t);\n");
+	Printf(f_im, "    }\n\n");
+	Printv(f_im, imclass_ffm_handles, NIL);
+	Printf(f_im, "  }\n");
+      }
+
       if (n_dmethods > 0) {
 	Putc('\n', f_im);
 	Printf(f_im, "  private final static native void swig_module_init();\n");
@@ -704,6 +731,8 @@ public:
     imclass_cppcasts_code = NULL;
     Delete(imclass_directors);
     imclass_directors = NULL;
+    Delete(imclass_ffm_handles);
+    imclass_ffm_handles = NULL;
     Delete(upcasts_code);
     upcasts_code = NULL;
     Delete(package);
@@ -822,6 +851,32 @@ public:
     return SWIG_OK;
   }
 
+  /* -----------------------------------------------------------------------
+   * ffmValueLayout()
+   *
+   * Return the java.lang.foreign.ValueLayout constant for passing a JNI type
+   * to a plain C function via the foreign function and memory API or NULL if
+   * the type or its intermediary class Java type is not a matching primitive.
+   * ----------------------------------------------------------------------- */
+
+  const char *ffmValueLayout(const String *jnitype, const String *jtype) {
+    static const char *layouts[][3] = {
+      { "jboolean", "boolean", "JAVA_BOOLEAN" },
+      { "jbyte", "byte", "JAVA_BYTE" },
+      { "jchar", "char", "JAVA_CHAR" },
+      { "jshort", "short", "JAVA_SHORT" },
+      { "jint", "int", "JAVA_INT" },
+      { "jlong", "long", "JAVA_LONG" },
+      { "jfloat", "float", "JAVA_FLOAT" },
+      { "jdouble", "double", "JAVA_DOUBLE" }
+    };
+    for (size_t i = 0; i < sizeof(layouts) / sizeof(layouts[0]); i++) {
+      if (Strcmp(jnitype, layouts[i][0]) == 0 && Strcmp(jtype, layouts[i][1]) == 0)
+	return layouts[i][2];
+    }
+    return 0;
+  }
+
   /* ----------------------------------------------------------------------
    * functionWrapper()
    * ---------------------------------------------------------------------- */
@@ -844,6 +899,10 @@ public:
     String *overloaded_name = getOverloadedName(n);
     String *nondir_args = NewString("");
     bool is_destructor = (Cmp(Getattr(n, "nodeType"), "destructor") == 0);
+    String *ffm_c_params = NewString("");	// C parameters, layouts and Java parameters for the foreign function and memory API
+    String *ffm_layouts = NewString("");
+    String *ffm_args = NewString("");
+    List *ffm_pgc_args = NewList();
 
     if (!Getattr(n, "sym:overloaded")) {
       if (!addSymbol(symname, n, imclass_name))
@@ -889,11 +948,8 @@ public:
 
     Printv(f->def, "SWIGEXPORT ", c_return_type, " JNICALL ", wname, "(JNIEnv *jenv, jclass jcls", NIL);
 
-    // Usually these function parameters are unused - The code below ensures
-    // that compilers do not issue such a warning if configured to do so.
-
-    Printv(f->code, "    (void)jenv;\n", NIL);
-    Printv(f->code, "    (void)jcls;\n", NIL);
+    // Only wrappers using just primitive types can be called via the foreign function and memory API
+    bool ffm_wrapper = ffm_flag && !native_function_flag && (is_void_return || ffmValueLayout(c_return_type, im_return_type));
 
     // Emit all of the local variables for holding arguments.
     emit_parameter_variables(l, f);
@@ -915,6 +971,7 @@ public:
       }
     }
 
+    int imclass_code_start = Len(imclass_class_code);
     Printf(imclass_class_code, "  public final static native %s %s(", im_return_type, overloaded_name);
 
     num_arguments = emit_num_arguments(l);
@@ -956,6 +1013,15 @@ public:
       // Add parameter to C function
       Printv(f->def, ", ", c_param_type, " ", arg, NIL);
 
+      const char *layout = ffmValueLayout(c_param_type, im_param_type);
+      if (layout) {
+	Printv(ffm_c_params, gencomma ? ", " : "", c_param_type, " ", arg, NIL);
+	Printv(ffm_layouts, ", java.lang.foreign.ValueLayout.", layout, NIL);
+	Printv(ffm_args, gencomma ? ", " : "", arg, NIL);
+      } else {
+	ffm_wrapper = false;
+      }
+
       ++gencomma;
 
       // Premature garbage collection prevention parameter
@@ -965,6 +1031,9 @@ public:
 	  Printf(imclass_class_code, ", %s %s_", pgc_parameter, arg);
 	  Printf(f->def, ", jobject %s_", arg);
 	  Printf(f->code, "    (void)%s_;\n", arg);
+	  String *pgc_arg = NewStringf("%s_", arg);
+	  Append(ffm_pgc_args, pgc_arg);
+	  Delete(pgc_arg);
 	}
       }
       // Get typemap for this argument
@@ -1112,6 +1181,60 @@ public:
       Printv(f->code, "    return jresult;\n", NIL);
     Printf(f->code, "}\n");
 
+    // Wrappers using the JNIEnv, such as for throwing exceptions or handling strings, must remain as JNI calls
+    if (ffm_wrapper) {
+      ffm_wrapper = !(Strstr(f->code, "jenv") || Strstr(f->code, "jcls") || Strstr(f->locals, "jenv") ||
+		      Strstr(f->code, "SWIG_contract_assert") || Strstr(f->code, "SWIG_exception"));
+    }
+
+    if (ffm_wrapper) {
+      String *ffm_wname = NewStringf("SwigFFM_%s", wname);
+
+      // Plain C function without the JNIEnv, jclass and jobject parameters
+      Clear(f->def);
+      Printv(f->def, "SWIGEXPORT ", c_return_type, " ", ffm_wname, "(", Len(ffm_c_params) > 0 ? ffm_c_params : "void", ") {", NIL);
+      for (Iterator it = First(ffm_pgc_args); it.item; it = Next(it)) {
+	String *unused = NewStringf("    (void)%s;\n", it.item);
+	Replaceall(f->code, unused, "");
+	Delete(unused);
+      }
+
+      // Downcall method handle
+      Printf(imclass_ffm_handles, "    final static java.lang.invoke.MethodHandle %s = downcall(\"%s\", java.lang.foreign.FunctionDescriptor.", overloaded_name, ffm_wname);
+      if (is_void_return)
+	Printf(imclass_ffm_handles, "ofVoid(%s));\n", Len(ffm_layouts) > 0 ? Char(ffm_layouts) + 2 : "");
+      else
+	Printf(imclass_ffm_handles, "of(java.lang.foreign.ValueLayout.%s%s));\n", ffmValueLayout(c_return_type, im_return_type), ffm_layouts);
+
+      // Replace the native method declaration with a method invoking the downcall method handle
+      String *im_declaration = NewString(Char(imclass_class_code) + imclass_code_start);
+      Delslice(imclass_class_code, imclass_code_start, DOH_END);
+      Replace(im_declaration, "public final static native ", "public final static ", DOH_REPLACE_FIRST);
+      Replace(im_declaration, ";\n", " {\n", DOH_REPLACE_FIRST);
+      Printv(imclass_class_code, im_declaration, "    try {\n", NIL);
+      if (is_void_return)
+	Printf(imclass_class_code, "      SwigFFM.%s.invokeExact(%s);\n", overloaded_name, ffm_args);
+      else
+	Printf(imclass_class_code, "      return (%s)SwigFFM.%s.invokeExact(%s);\n", im_return_type, overloaded_name, ffm_args);
+      Printf(imclass_class_code, "    } catch (Throwable swigException) {\n");
+      Printf(imclass_class_code, "      throw SwigFFM.rethrow(swigException);\n");
+      if (Len(ffm_pgc_args) > 0) {
+	// The proxy objects must stay reachable for the duration of the call as they do when passed to JNI
+	Printf(imclass_class_code, "    } finally {\n");
+	for (Iterator it = First(ffm_pgc_args); it.item; it = Next(it))
+	  Printf(imclass_class_code, "      java.lang.ref.Reference.reachabilityFence(%s);\n", it.item);
+      }
+      Printf(imclass_class_code, "    }\n  }\n");
+
+      Delete(im_declaration);
+      Delete(ffm_wname);
+    } else {
+      // Usually these function parameters are unused - The code below ensures
+      // that compilers do not issue such a warning if configured to do so.
+      Insert(f->code, 0, "    (void)jcls;\n");
+      Insert(f->code, 0, "    (void)jenv;\n");
+    }
+
     /* Substitute the cleanup code */
     Replaceall(f->code, "$cleanup", cleanup);
 
@@ -1163,6 +1286,10 @@ public:
     Delete(outarg);
     Delete(body);
     Delete(overloaded_name);
+    Delete(ffm_pgc_args);
+    Delete(ffm_args);
+    Delete(ffm_layouts);
+    Delete(ffm_c_params);
     DelWrapper(f);
     return SWIG_OK;
   }
@@ -4856,6 +4983,8 @@ extern "C" Language *swig_java(void) {
 
 const char *JAVA::usage = "\
 Java Options (available with -java)\n\
+     -ffm            - Call wrappers which do not need JNI through the foreign function\n\
+                       and memory API (Java 22 or later)\n\
      -nopgcpp        - Suppress premature garbage collection prevention parameter\n\
      -noproxy        - Generate the low-level functional interface instead\n\
                        of proxy classes\n\
@@ -1025,6 +1025,7 @@ public:
 
     Printv(f_wrappers, "static const char *swig_", class_name, "_base_names[] = {", base_class_names, "0};\n", NIL);
     Printv(f_wrappers, "static const swig_type_info *swig_", class_name, "_base[] = {", base_class, "0};\n", NIL);
+    Printv(f_wrappers, "static swig_octave_member_table swig_", class_name, "_member_table;\n", NIL);
     Printv(f_wrappers, "static swig_octave_class _wrap_class_", class_name, " = {\"", class_name, "\", &SWIGTYPE", SwigType_manglestr(t), ",", NIL);
     Printv(f_wrappers, Swig_directorclass(n) ? "1," : "0,", NIL);
     if (have_constructor) {
@@ -1047,7 +1048,7 @@ public:
       Delete(cname);
     } else
       Printv(f_wrappers, "0", ",", NIL);
-    Printf(f_wrappers, "swig_%s_members,swig_%s_base_names,swig_%s_base };\n\n", class_name, class_name, class_name);
+    Printf(f_wrappers, "swig_%s_members,swig_%s_base_names,swig_%s_base,&swig_%s_member_table,false };\n\n", class_name, class_name, class_name, class_name);
 
     Delete(base_class);
     Delete(base_class_names);
@@ -84,7 +84,7 @@ static String *s_wrappers;
 static String *s_init;
 static String *r_init;		// RINIT user code
 static String *s_shutdown;	// MSHUTDOWN user code
-static String *r_shutdown;	// RSHUTDOWN user code
+static String *r_shutdown;	// RSHUTDOWN user code and generated cleanup
 static String *s_vinit;		// varinit initialization code.
 static String *s_vdecl;
 static String *s_cinit;		// consttab initialization code.
@@ -177,15 +177,18 @@ static void SwigPHP_emit_resource_registrations() {
     }
 
     // declare le_swig_<mangled> to store php registration
-    Printf(s_vdecl, "static int le_swig_%s=0; /* handle for %s */\n", key, human_name);
+    Printf(s_vdecl, "static swig_php_clientdata le_swig_%s={0,NULL,0}; /* handle for %s */\n", key, human_name);
 
     // register with php
-    Printf(s_oinit, "le_swig_%s=zend_register_list_destructors_ex"
+    Printf(s_oinit, "le_swig_%s.type=zend_register_list_destructors_ex"
 		    "(%s, NULL, SWIGTYPE%s->name, module_number);\n", key, rsrc_dtor_name, key);
 
     // store php type in class struct
     Printf(s_oinit, "SWIG_TypeClientData(SWIGTYPE%s,&le_swig_%s);\n", key, key);
 
+    // the class cached for converting objects to the type may be freed with the request
+    Printf(r_shutdown, "le_swig_%s.ce=NULL;\n", key);
+
     Delete(rsrc_dtor_name);
 
     ki = Next(ki);
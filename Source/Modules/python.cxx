@@ -46,6 +46,7 @@ static String *f_shadow_begin = 0;
 static Hash *f_shadow_imports = 0;
 static String *f_shadow_after_begin = 0;
 static String *f_shadow_stubs = 0;
+static String *f_shadow_class_stubs = 0;
 static Hash *builtin_getset = 0;
 static Hash *builtin_closures = 0;
 static Hash *class_members = 0;
@@ -97,6 +98,13 @@ static int extranative = 0;
 static int outputtuple = 0;
 static int nortti = 0;
 static int relativeimport = 0;
+static int fastimport = 0;
+static String *lazy_register = 0;
+static int lazy_count = 0;
+static int fastconst = 0;
+static Hash *const_table = 0;
+static int intenum = 0;
+static String *enum_members = 0;
 
 /* flags for the make_autodoc function */
 enum autodoc_t {
@@ -120,11 +128,14 @@ Python Options (available with -python)\n\
      -cppcast        - Enable C++ casting operators (default) \n\
      -dirvtable      - Generate a pseudo virtual table for directors for faster dispatch \n\
      -extranative    - Return extra native C++ wraps for std containers when possible \n\
+     -fastconst      - Create constants on first use (Python 3.7 and later) \n\
+     -fastimport     - Create proxy classes on first use (Python 3.7 and later) \n\
      -fastinit       - Use fast init mechanism for classes (default)\n\
      -fastunpack     - Use fast unpack mechanism to parse the argument functions \n\
      -fastproxy      - Use fast proxy mechanism for member methods \n\
      -fastquery      - Use fast query mechanism for types \n\
      -globals <name> - Set <name> used to access C global variable [default: 'cvar']\n\
+     -intenum        - Create an enum.IntEnum class on first use for each named enum \n\
      -interface <lib>- Set the lib name to <lib>\n\
      -keyword        - Use keyword arguments\n\
      -modern         - Use modern python features only, without compatibility code\n\
@@ -139,11 +150,14 @@ static const char *usage2 = "\
      -nodirvtable    - Don't use the virtual table feature, resolve the python method each time (default)\n\
      -noexcept       - No automatic exception handling\n\
      -noextranative  - Don't use extra native C++ wraps for std containers when possible (default) \n\
+     -nofastconst    - Create all the constants when the module is imported (default) \n\
+     -nofastimport   - Create all the proxy classes when the module is imported (default) \n\
      -nofastinit     - Use traditional init mechanism for classes \n\
      -nofastunpack   - Use traditional UnpackTuple method to parse the argument functions (default) \n\
      -nofastproxy    - Use traditional proxy mechanism for member methods (default) \n\
      -nofastquery    - Use traditional query mechanism for types (default) \n\
      -noh            - Don't generate the output header file\n\
+     -nointenum      - Don't create classes for enums, only the enum values are wrapped (default) \n\
      -nomodern       - Don't use modern python features which are not backwards compatible \n\
      -nomodernargs   - Use classic ParseTuple/CallFunction methods to pack/unpack the function arguments (default) \n";
 static const char *usage3 = "\
@@ -438,6 +452,24 @@ public:
 	} else if (strcmp(argv[i], "-nofastquery") == 0) {
 	  fastquery = 0;
 	  Swig_mark_arg(i);
+	} else if (strcmp(argv[i], "-fastimport") == 0) {
+	  fastimport = 1;
+	  Swig_mark_arg(i);
+	} else if (strcmp(argv[i], "-nofastimport") == 0) {
+	  fastimport = 0;
+	  Swig_mark_arg(i);
+	} else if (strcmp(argv[i], "-fastconst") == 0) {
+	  fastconst = 1;
+	  Swig_mark_arg(i);
+	} else if (strcmp(argv[i], "-nofastconst") == 0) {
+	  fastconst = 0;
+	  Swig_mark_arg(i);
+	} else if (strcmp(argv[i], "-intenum") == 0) {
+	  intenum = 1;
+	  Swig_mark_arg(i);
+	} else if (strcmp(argv[i], "-nointenum") == 0) {
+	  intenum = 0;
+	  Swig_mark_arg(i);
 	} else if (strcmp(argv[i], "-fastinit") == 0) {
 	  fastinit = 1;
 	  Swig_mark_arg(i);
@@ -538,6 +570,18 @@ public:
       classic = 0;
     }
 
+    if (builtin) {
+      /* built-in types are created by the C module, there are no proxy classes to defer */
+      fastimport = 0;
+      /* the proxy module imports all the names of the C module */
+      fastconst = 0;
+      intenum = 0;
+    }
+
+    if (fastconst) {
+      Preprocessor_define("SWIGPYTHON_FASTCONST", 0);
+    }
+
     if (cppcast) {
       Preprocessor_define((DOH *) "SWIG_CPLUSPLUS_CAST", 0);
     }
@@ -662,6 +706,8 @@ public:
     Swig_register_filebyname("director_h", f_directors_h);
 
     const_code = NewString("");
+    if (fastconst)
+      const_table = NewHash();
     methods = NewString("");
 
     Swig_banner(f_begin);
@@ -721,6 +767,10 @@ public:
       Printf(f_runtime, "#define SWIGPYTHON_BUILTIN\n");
     }
 
+    if (fastconst) {
+      Printf(f_runtime, "#define SWIGPYTHON_FASTCONST\n");
+    }
+
     Printf(f_runtime, "\n");
 
     Printf(f_header, "#if (PY_VERSION_HEX <= 0x02000000)\n");
@@ -801,6 +851,7 @@ public:
       f_shadow_imports = NewHash();
       f_shadow_after_begin = NewString("");
       f_shadow_stubs = NewString("");
+      f_shadow_class_stubs = NewString("");
 
       Swig_register_filebyname("shadow", f_shadow);
       Swig_register_filebyname("python", f_shadow);
@@ -984,6 +1035,66 @@ public:
 	Printv(f_shadow,
 	       "try:\n", tab4, "import weakref\n", tab4, "weakref_proxy = weakref.proxy\n", "except __builtin__.Exception:\n", tab4, "weakref_proxy = lambda x: x\n", "\n\n", NIL);
       }
+
+      if (fastimport || fastconst || intenum) {
+	// Proxy and enum classes are created by functions registered in _swig_lazy_classes when first accessed,
+	// constants are created by the __getattr__ of the C module (-fastconst).
+	// A class is created under a lock and its function stays registered until the class is in globals(),
+	// so other threads asking for it wait for it instead of finding neither.
+	Printv(f_shadow,
+	       "try:\n", tab4, "from threading import RLock as _swig_RLock\n",
+	       "except ImportError:\n", tab4, "from dummy_threading import RLock as _swig_RLock\n",
+	       "_swig_lazy_lock = _swig_RLock()\n",
+	       "_swig_lazy_classes = {}\n\n",
+	       "\n", "def _swig_lazy_class(name):\n",
+	       tab4, "try:\n", tab8, "return globals()[name]\n",
+	       tab4, "except KeyError:\n", tab8, "pass\n",
+	       tab4, "with _swig_lazy_lock:\n",
+	       tab8, "try:\n", tab8, tab4, "return globals()[name]\n",
+	       tab8, "except KeyError:\n", tab8, tab4, "pass\n",
+	       tab8, "create = _swig_lazy_classes.get(name)\n",
+	       tab8, "if create is None:\n", NIL);
+	if (fastconst) {
+	  Printv(f_shadow, tab8, tab4, "return _swig_lazy_constant(name)\n", NIL);
+	} else {
+	  Printv(f_shadow, tab8, tab4, "raise AttributeError(\"module '%s' has no attribute '%s'\" % (__name__, name))\n", NIL);
+	}
+	Printv(f_shadow,
+	       tab8, "create()\n",
+	       tab8, "_swig_lazy_classes.pop(name, None)\n",
+	       tab8, "return globals()[name]\n\n", NIL);
+	if (fastconst) {
+	  Printv(f_shadow,
+		 "\n", "def _swig_lazy_constant(name):\n",
+		 tab4, "try:\n", tab8, "globals()[name] = ", module, ".__getattr__(name)\n",
+		 tab4, "except AttributeError:\n", tab8, "pass\n",
+		 tab4, "else:\n", tab8, "return globals()[name]\n",
+		 tab4, "raise AttributeError(\"module '%s' has no attribute '%s'\" % (__name__, name))\n\n", NIL);
+	}
+	if (intenum) {
+	  Printv(f_shadow,
+		 "\n", "def _swig_int_enum(name, members):\n",
+		 tab4, "try:\n", tab8, "from enum import IntEnum\n", tab8, "return IntEnum(name, members, module=__name__)\n",
+		 tab4, "except (ImportError, ValueError):\n",
+		 tab8, "# No enum module or a name reserved by IntEnum, use a class holding the values\n",
+		 tab8, "return type(name, (object,), dict(members))\n\n", NIL);
+	}
+	Printv(f_shadow,
+	       "\n", "def __getattr__(name):\n",
+	       tab4, "if name == \"__all__\":\n", tab8, "return [n for n in __dir__() if not n.startswith('_')]\n",
+	       tab4, "return _swig_lazy_class(name)\n\n",
+	       "\n", "def __dir__():\n", NIL);
+	if (fastconst) {
+	  Printv(f_shadow, tab4, "return sorted(set(globals()) | set(_swig_lazy_classes) | set(", module, ".SWIG_PyConstantNames()))\n\n", NIL);
+	} else {
+	  Printv(f_shadow, tab4, "return sorted(set(globals()) | set(_swig_lazy_classes))\n\n", NIL);
+	}
+      }
+
+      if (fastimport) {
+	lazy_register = NewString("");
+	Printv(f_shadow, "\n", module, ".SWIG_PyLazyRegister(_swig_lazy_class)\n\n", NIL);
+      }
     }
     // Include some information in the code
     Printf(f_header, "\n/*-----------------------------------------------\n              @(target):= %s.so\n\
@@ -1015,6 +1126,31 @@ public:
     /* emit code */
     Language::top(n);
 
+    if (fastimport && shadow) {
+      /* the method registering the proxy module function that creates the classes on first use */
+      if (lazy_count) {
+	Printv(f_wrappers, "SWIGINTERN PyObject *SWIG_PyLazyRegister(PyObject *SWIGUNUSEDPARM(self), PyObject *loader) {\n", NIL);
+	Printf(f_wrappers, "  static SwigPyClientData clientdata[%d];\n", lazy_count);
+	Printv(f_wrappers, lazy_register, NIL);
+      } else {
+	Printv(f_wrappers, "SWIGINTERN PyObject *SWIG_PyLazyRegister(PyObject *SWIGUNUSEDPARM(self), PyObject *SWIGUNUSEDPARM(loader)) {\n", NIL);
+      }
+      Printv(f_wrappers, "  return SWIG_Py_Void();\n", "}\n\n", NIL);
+      Printf(methods, "\t { (char *)\"SWIG_PyLazyRegister\", (PyCFunction)SWIG_PyLazyRegister, METH_O, NULL},\n");
+    }
+    Delete(lazy_register);
+    lazy_register = 0;
+
+    if (fastconst) {
+      /* the module functions creating the constants on first use, defined in pyinit.swg */
+      Printv(f_wrappers, "SWIGINTERN PyObject *SWIG_Python_ConstantGetAttr(PyObject *self, PyObject *name);\n",
+	     "SWIGINTERN PyObject *SWIG_Python_ConstantDir(PyObject *self, PyObject *args);\n",
+	     "SWIGINTERN PyObject *SWIG_Python_ConstantNames(PyObject *self, PyObject *args);\n\n", NIL);
+      Printf(methods, "\t { (char *)\"__getattr__\", (PyCFunction)SWIG_Python_ConstantGetAttr, METH_O, NULL},\n");
+      Printf(methods, "\t { (char *)\"__dir__\", (PyCFunction)SWIG_Python_ConstantDir, METH_NOARGS, NULL},\n");
+      Printf(methods, "\t { (char *)\"SWIG_PyConstantNames\", (PyCFunction)SWIG_Python_ConstantNames, METH_NOARGS, NULL},\n");
+    }
+
     if (directorsEnabled()) {
       // Insert director runtime into the f_runtime file (make it occur before %header section)
       Swig_insert_file("director_common.swg", f_runtime);
@@ -1032,6 +1168,17 @@ public:
 
     SwigType_emit_type_table(f_runtime, f_wrappers);
 
+    if (fastconst) {
+      /* the constants are looked up by name with a binary search */
+      List *names = Keys(const_table);
+      SortList(names, 0);
+      for (Iterator ki = First(names); ki.item; ki = Next(ki)) {
+	Printf(const_code, "%s,\n", Getattr(const_table, ki.item));
+      }
+      Delete(names);
+      Delete(const_table);
+      const_table = 0;
+    }
     Append(const_code, "{0, 0, 0, 0.0, 0, 0}};\n");
     Printf(f_wrappers, "%s\n", const_code);
     initialize_threads(f_init);
@@ -1064,6 +1211,16 @@ public:
       }
       Printv(f_shadow_py, f_shadow, "\n", NIL);
       Printv(f_shadow_py, f_shadow_stubs, "\n", NIL);
+      if (fastimport || fastconst || intenum) {
+	Printv(f_shadow_py, "from sys import version_info as _swig_python_version_info\n",
+	       "if _swig_python_version_info < (3, 7, 0):\n",
+	       tab4, "# Module __getattr__ is not supported, create all the constants and classes now\n", NIL);
+	if (fastconst) {
+	  Printv(f_shadow_py, tab4, "list(map(_swig_lazy_constant, ", module, ".SWIG_PyConstantNames()))\n", NIL);
+	}
+	Printv(f_shadow_py, tab4, "list(map(_swig_lazy_class, list(_swig_lazy_classes)))\n",
+	       "del _swig_python_version_info\n", NIL);
+      }
       Delete(f_shadow_py);
     }
 
@@ -2167,8 +2324,13 @@ public:
 	else if (!Strchr(s, ':')) {
 	  Node *lookup = Swig_symbol_clookup(v, 0);
 	  if (lookup) {
-	    if (Cmp(Getattr(lookup, "nodeType"), "enumitem") == 0)
-	      result = Copy(Getattr(lookup, "sym:name"));
+	    if (Cmp(Getattr(lookup, "nodeType"), "enumitem") == 0) {
+	      // With -fastconst the proxy module only defines the enum value when first used
+	      if (fastconst && !GetFlag(lookup, "ismember"))
+		result = NewStringf("%s.%s", module, Getattr(lookup, "sym:name"));
+	      else
+		result = Copy(Getattr(lookup, "sym:name"));
+	    }
 	  }
 	}
       }
@@ -2772,7 +2934,8 @@ public:
 	over_varargs = true;
     }
 
-    int funpack = modernargs && fastunpack && !varargs && !over_varargs && !allow_kwargs;
+    // Builtin member variable accessors are always called by the getset closures without an argument tuple
+    int funpack = ((modernargs && fastunpack) || builtin_getter || builtin_setter) && !varargs && !over_varargs && !allow_kwargs;
     int noargs = funpack && (tuple_required == 0 && tuple_arguments == 0);
     int onearg = funpack && (tuple_required == 1 && tuple_arguments == 1);
 
@@ -2917,7 +3080,7 @@ public:
 
     if (builtin && !funpack && in_class && tuple_arguments == 0) {
       Printf(parse_args, "    if (args && PyTuple_Check(args) && PyTuple_GET_SIZE(args) > 0) SWIG_exception_fail(SWIG_TypeError, \"%s takes no arguments\");\n", iname);
-    } else if (use_parse || allow_kwargs || !modernargs) {
+    } else if (use_parse || allow_kwargs || (!modernargs && !funpack)) {
       Printf(parse_args, ":%s\"", iname);
       Printv(parse_args, arglist, ")) SWIG_fail;\n", NIL);
       funpack = 0;
@@ -2933,7 +3096,9 @@ public:
 	  }
 	  Printf(parse_args, "if ((nobjs < %d) || (nobjs > %d)) SWIG_fail;\n", num_required, num_arguments);
 	} else {
-	  if (noargs) {
+	  if (noargs && builtin_getter) {
+	    Printv(f->def, linkage, wrap_return, wname, "(PyObject *", self_param, ", PyObject *SWIGUNUSEDPARM(args)) {", NIL);
+	  } else if (noargs) {
 	    Printv(f->def, linkage, wrap_return, wname, "(PyObject *", self_param, ", PyObject *args) {", NIL);
 	  } else {
 	    Printv(f->def, linkage, wrap_return, wname, "(PyObject *", self_param, ", PyObject *args) {", NIL);
@@ -2943,7 +3108,7 @@ public:
 	    Append(parse_args, "swig_obj[0] = args;\n");
 	  } else if (!noargs) {
 	    Printf(parse_args, "if (!SWIG_Python_UnpackTuple(args,\"%s\",%d,%d,swig_obj)) SWIG_fail;\n", iname, num_fixed_arguments, tuple_arguments);
-	  } else if (noargs) {
+	  } else if (noargs && !builtin_getter) {
 	    Printf(parse_args, "if (!SWIG_Python_UnpackTuple(args,\"%s\",%d,%d,0)) SWIG_fail;\n", iname, num_fixed_arguments, tuple_arguments);
 	  }
 	}
@@ -3303,6 +3468,7 @@ public:
         Delete(h);
       }
       Setattr(h, "getter", "SwigPyObject_get___dict__");
+      SetFlag(h, "getter:funpack");
     }
 
     if (builtin_getter) {
@@ -3316,6 +3482,8 @@ public:
 	Delete(h);
       }
       Setattr(h, "getter", wrapper_name);
+      if (funpack)
+	SetFlag(h, "getter:funpack");
       Delattr(n, "memberget");
     }
     if (builtin_setter) {
@@ -3329,6 +3497,8 @@ public:
 	Delete(h);
       }
       Setattr(h, "setter", wrapper_name);
+      if (funpack)
+	SetFlag(h, "setter:funpack");
       Delattr(n, "memberset");
     }
 
@@ -3543,6 +3713,7 @@ public:
     String *value = rawval ? rawval : Getattr(n, "value");
     String *tm;
     int have_tm = 0;
+    int have_consttab = 0;
     int have_builtin_symname = 0;
 
     if (!addSymbol(iname, n))
@@ -3561,9 +3732,15 @@ public:
       Replaceall(tm, "$source", value);
       Replaceall(tm, "$target", name);
       Replaceall(tm, "$value", value);
-      Printf(const_code, "%s,\n", tm);
+      if (const_table) {
+	/* emitted sorted by name, see top() */
+	Setattr(const_table, iname, tm);
+      } else {
+	Printf(const_code, "%s,\n", tm);
+      }
       Delete(tm);
       have_tm = 1;
+      have_consttab = 1;
     }
 
 
@@ -3623,7 +3800,13 @@ public:
       return SWIG_NOWRAP;
     }
 
-    if (!builtin && (shadow) && (!(shadow & PYSHADOW_MEMBER))) {
+    if (enum_members && !in_class) {
+      String *member = Getattr(n, "enumvalueDeclaration:sym:name");
+      Printf(enum_members, tab8 "(\"%s\", %s.%s),\n", member ? member : iname, module, iname);
+    }
+
+    /* with -fastconst the constants in the table are created by __getattr__ on first use */
+    if (!builtin && (shadow) && (!(shadow & PYSHADOW_MEMBER)) && !(fastconst && have_consttab)) {
       if (!in_class) {
 	if(needs_swigconstant(n)) {
 	  Printv(f_shadow, "\n",NIL);
@@ -3644,6 +3827,32 @@ public:
   }
 
 
+  /* ------------------------------------------------------------
+   * enumDeclaration()
+   *
+   * With -intenum, a named enum which is not a class member is also
+   * wrapped as an IntEnum class created on first use.
+   * ------------------------------------------------------------ */
+
+  virtual int enumDeclaration(Node *n) {
+    String *symname = Getattr(n, "sym:name");
+    if (!intenum || !shadow || in_class || ImportMode || !symname || Strchr(symname, '$'))
+      return Language::enumDeclaration(n);
+
+    enum_members = NewString("");
+    int result = Language::enumDeclaration(n);
+    if (Len(enum_members) > 0 && !symbolLookup(symname)) {
+      addSymbol(symname, n);
+      Printv(f_shadow, "\n", "def _swig_create_", symname, "():\n",
+	     tab4, "global ", symname, "\n",
+	     tab4, symname, " = _swig_int_enum(\"", symname, "\", [\n", enum_members, tab4, "])\n",
+	     "_swig_lazy_classes[\"", symname, "\"] = _swig_create_", symname, "\n\n", NIL);
+    }
+    Delete(enum_members);
+    enum_members = 0;
+    return result;
+  }
+
   /* ------------------------------------------------------------ 
    * nativeWrapper()
    * ------------------------------------------------------------ */
@@ -3782,8 +3991,6 @@ public:
    * ------------------------------------------------------------ */
 
   int classDirectorEnd(Node *n) {
-    String *classname = Swig_class_name(n);
-
     if (dirprot_mode()) {
       /*
          This implementation uses a std::map<std::string,int>.
@@ -3812,22 +4019,13 @@ public:
       Printf(f_directors_h, "\n");
       Printf(f_directors_h, "#if defined(SWIG_PYTHON_DIRECTOR_VTABLE)\n");
       Printf(f_directors_h, "/* VTable implementation */\n");
+      Printf(f_directors_h, "    static Swig::DirectorMethodCache &swig_method_cache() {\n");
+      Printf(f_directors_h, "      static Swig::DirectorMethodCache cache(%d);\n", director_method_index);
+      Printf(f_directors_h, "      return cache;\n");
+      Printf(f_directors_h, "    }\n");
       Printf(f_directors_h, "    PyObject *swig_get_method(size_t method_index, const char *method_name) const {\n");
-      Printf(f_directors_h, "      PyObject *method = vtable[method_index];\n");
-      Printf(f_directors_h, "      if (!method) {\n");
-      Printf(f_directors_h, "        swig::SwigVar_PyObject name = SWIG_Python_str_FromChar(method_name);\n");
-      Printf(f_directors_h, "        method = PyObject_GetAttr(swig_get_self(), name);\n");
-      Printf(f_directors_h, "        if (!method) {\n");
-      Printf(f_directors_h, "          std::string msg = \"Method in class %s doesn't exist, undefined \";\n", classname);
-      Printf(f_directors_h, "          msg += method_name;\n");
-      Printf(f_directors_h, "          Swig::DirectorMethodException::raise(msg.c_str());\n");
-      Printf(f_directors_h, "        }\n");
-      Printf(f_directors_h, "        vtable[method_index] = method;\n");
-      Printf(f_directors_h, "      }\n");
-      Printf(f_directors_h, "      return method;\n");
+      Printf(f_directors_h, "      return swig_method_cache().get(swig_get_self(), method_index, method_name);\n");
       Printf(f_directors_h, "    }\n");
-      Printf(f_directors_h, "private:\n");
-      Printf(f_directors_h, "    mutable swig::SwigVar_PyObject vtable[%d];\n", director_method_index);
       Printf(f_directors_h, "#endif\n\n");
     }
 
@@ -3993,8 +4191,10 @@ public:
       Hash *mgetset = member_iter.item;
       String *getter = Getattr(mgetset, "getter");
       String *setter = Getattr(mgetset, "setter");
-      const char *getter_closure = getter ? funpack ? "SwigPyBuiltin_FunpackGetterClosure" : "SwigPyBuiltin_GetterClosure" : "0";
-      const char *setter_closure = setter ? funpack ? "SwigPyBuiltin_FunpackSetterClosure" : "SwigPyBuiltin_SetterClosure" : "0";
+      bool getter_funpack = funpack || GetFlag(mgetset, "getter:funpack");
+      bool setter_funpack = funpack || GetFlag(mgetset, "setter:funpack");
+      const char *getter_closure = getter ? getter_funpack ? "SwigPyBuiltin_FunpackGetterClosure" : "SwigPyBuiltin_GetterClosure" : "0";
+      const char *setter_closure = setter ? setter_funpack ? "SwigPyBuiltin_FunpackSetterClosure" : "SwigPyBuiltin_SetterClosure" : "0";
       String *gspair = NewStringf("%s_%s_getset", symname, memname);
       Printf(f, "static SwigPyGetSet %s = { %s, %s };\n", gspair, getter ? getter : "0", setter ? setter : "0");
       String *entry =
@@ -4346,6 +4546,7 @@ public:
     int oldclassic = classic;
     int oldmodern = modern;
     File *f_shadow_file = f_shadow;
+    File *f_shadow_module = 0;
     Node *base_node = NULL;
 
     if (shadow) {
@@ -4373,6 +4574,12 @@ public:
       if (!addSymbol(class_name, n))
 	return SWIG_ERROR;
 
+      if (fastimport) {
+	/* Collect the whole class, it is emitted in a function creating it on first use */
+	f_shadow_module = f_shadow;
+	f_shadow = f_shadow_file = NewString("");
+      }
+
       if (builtin) {
 	List *baselist = Getattr(n, "bases");
 	if (baselist && Len(baselist) > 0) {
@@ -4553,6 +4760,8 @@ public:
 	String *cname = NewStringf("%s_swigregister", class_name);
 	add_method(cname, cname, 0);
 	Delete(cname);
+	if (fastimport)
+	  Printf(lazy_register, "  SWIG_Python_SetLazyClientData(SWIGTYPE%s, &clientdata[%d], loader, \"%s\");\n", SwigType_manglestr(ct), lazy_count++, class_name);
       }
       Delete(smart);
       Delete(ct);
@@ -4620,6 +4829,14 @@ public:
       }
 
       shadow_indent = 0;
+      if (f_shadow_module) {
+	/* Code using the class is run when the class is created */
+	Printv(f_shadow_file, f_shadow_class_stubs, NIL);
+	Clear(f_shadow_class_stubs);
+	emitLazyClass(f_shadow_module, n, f_shadow_file);
+	Delete(f_shadow_file);
+	f_shadow_file = f_shadow_module;
+      }
       Printf(f_shadow_file, "%s\n", f_shadow_stubs);
       Clear(f_shadow_stubs);
     }
@@ -4640,6 +4857,53 @@ public:
     return SWIG_OK;
   }
 
+  /* ------------------------------------------------------------
+   * emitLazyClass()
+   *
+   * Emit the code of a proxy class into a function creating the class,
+   * which is called when the class is first used.
+   * ------------------------------------------------------------ */
+
+  void emitLazyClass(File *f_out, Node *n, String *code) {
+    String *name = Getattr(n, "sym:name");
+    String *create = NewStringf("_swig_create_%s", name);
+    Printv(f_out, "\ndef ", create, "():\n", tab4, "global ", name, NIL);
+    if (classptr)
+      Printv(f_out, ", ", name, "Ptr", NIL);
+    Printv(f_out, "\n", NIL);
+
+    /* Base classes in this module must be created first */
+    List *baselist = Getattr(n, "bases");
+    for (Iterator b = First(baselist); b.item; b = Next(b)) {
+      String *bname = Getattr(b.item, "python:proxy");
+      if (bname && !GetFlag(b.item, "feature:ignore") && !Strchr(bname, '.'))
+	Printv(f_out, tab4, "_swig_lazy_class(\"", bname, "\")\n", NIL);
+    }
+
+    /* Indent the class code, except for the continuation lines of triple quoted strings */
+    const char *quote = 0;
+    bool line_start = true;
+    for (const char *c = Char(code); *c; ++c) {
+      if (line_start && !quote && *c != '\n')
+	Append(f_out, tab4);
+      line_start = *c == '\n';
+      if ((*c == '"' || *c == '\'') && c[1] == *c && c[2] == *c) {
+	if (!quote)
+	  quote = c;
+	else if (*quote == *c)
+	  quote = 0;
+	Putc(*c++, f_out);
+	Putc(*c++, f_out);
+      }
+      Putc(*c, f_out);
+    }
+
+    Printv(f_out, "_swig_lazy_classes[\"", name, "\"] = ", create, "\n", NIL);
+    if (classptr)
+      Printv(f_out, "_swig_lazy_classes[\"", name, "Ptr\"] = ", create, "\n", NIL);
+    Delete(create);
+  }
+
   /* ------------------------------------------------------------
    * functionHandler()  -  Mainly overloaded for callback handling
    * ------------------------------------------------------------ */
@@ -5103,7 +5367,7 @@ public:
     if (shadow) {
       if (!builtin && GetFlag(n, "hasconsttype")) {
 	String *mname = Swig_name_member(NSPACE_TODO, class_name, symname);
-	Printf(f_shadow_stubs, "%s.%s = %s.%s.%s\n", class_name, symname, module, global_name, mname);
+	Printf(fastimport ? f_shadow_class_stubs : f_shadow_stubs, "%s.%s = %s.%s.%s\n", class_name, symname, module, global_name, mname);
 	Delete(mname);
       } else {
 	String *mname = Swig_name_member(NSPACE_TODO, class_name, symname);
@@ -5593,19 +5857,21 @@ int PYTHON::classDirectorMethod(Node *n, Node *parent, String *super) {
     Printf(w->code, "const size_t swig_method_index = %d;\n", director_method_index++);
     Printf(w->code, "const char *const swig_method_name = \"%s\";\n", pyname);
 
-    Append(w->code, "PyObject *method = swig_get_method(swig_method_index, swig_method_name);\n");
+    Append(w->code, "swig::SwigVar_PyObject method = swig_get_method(swig_method_index, swig_method_name);\n");
     if (Len(parse_args) > 0) {
       if (use_parse || !modernargs) {
-	Printf(w->code, "swig::SwigVar_PyObject %s = PyObject_CallFunction(method, (char *)\"(%s)\" %s);\n", Swig_cresult_name(), parse_args, arglist);
+	Printf(w->code, "swig::SwigVar_PyObject %s = method ? PyObject_CallFunction(method, (char *)\"(O%s)\", swig_get_self() %s) :\n", Swig_cresult_name(), parse_args, arglist);
+	Printf(w->code, "  PyObject_CallMethod(swig_get_self(), (char *)\"%s\", (char *)\"(%s)\" %s);\n", pyname, parse_args, arglist);
       } else {
-	Printf(w->code, "swig::SwigVar_PyObject %s = PyObject_CallFunctionObjArgs(method %s, NULL);\n", Swig_cresult_name(), arglist);
+	Printf(w->code, "swig::SwigVar_PyObject %s = method ? PyObject_CallFunctionObjArgs(method, swig_get_self() %s, NULL) :\n", Swig_cresult_name(), arglist);
+	Printf(w->code, "  PyObject_CallMethodObjArgs(swig_get_self(), swig_method_cache().name(swig_method_index, swig_method_name) %s, NULL);\n", arglist);
       }
     } else {
+      Printf(w->code, "swig::SwigVar_PyObject %s = method ? PyObject_CallFunctionObjArgs(method, swig_get_self(), NULL) :\n", Swig_cresult_name());
       if (modernargs) {
-	Append(w->code, "swig::SwigVar_PyObject args = PyTuple_New(0);\n");
-	Printf(w->code, "swig::SwigVar_PyObject %s = PyObject_Call(method, (PyObject *) args, NULL);\n", Swig_cresult_name());
+	Append(w->code, "  PyObject_CallMethodObjArgs(swig_get_self(), swig_method_cache().name(swig_method_index, swig_method_name), NULL);\n");
       } else {
-	Printf(w->code, "swig::SwigVar_PyObject %s = PyObject_CallFunction(method, NULL, NULL);\n", Swig_cresult_name());
+	Printf(w->code, "  PyObject_CallMethod(swig_get_self(), (char *) \"%s\", NULL);\n", pyname);
       }
     }
     Append(w->code, "#else\n");
@@ -803,6 +803,8 @@ int R::top(Node *n) {
   Swig_banner(f_begin);
 
   Printf(f_runtime, "\n\n#ifndef SWIGR\n#define SWIGR\n#endif\n\n");
+  Printf(f_runtime, "#define SWIG_name \"%s\"\n", module);
+  Printf(f_runtime, "#define SWIG_R_PACKAGE \"%s\"\n\n", Rpackage);
 
   
   Swig_banner_target_lang(s_init, "#");
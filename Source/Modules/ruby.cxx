@@ -1850,7 +1850,7 @@ public:
 	    Wrapper_add_local(f, result_name, result_var);
 	    Printf(action, "\n%s = new %s(%s);", result_name, SwigType_namestr(smart), Swig_cresult_name());
 	  }
-	  Printf(action, "\nDATA_PTR(self) = %s;", result_name);
+	  Printf(action, "\nSWIG_Ruby_SetObjectPtr(self, %s);", result_name);
 	  if (GetFlag(pn, "feature:trackobjects")) {
 	    Printf(action, "\nSWIG_RubyAddTracking(%s, self);", result_name);
 	  }
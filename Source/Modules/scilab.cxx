@@ -392,6 +392,13 @@ public:
 	Setattr(param, "emit:input", source);
 	Replaceall(paramTypemap, "$input", Getattr(param, "emit:input"));
 
+	if (Strstr(paramTypemap, "$outputposition")) {
+	  // Position of the output value set by the argout typemap, for typemaps creating it before the call
+	  String *position = NewStringf("%d", outputPosition(node, functionParamsList, param));
+	  Replaceall(paramTypemap, "$outputposition", position);
+	  Delete(position);
+	}
+
 	if (Getattr(param, "wrap:disown") || (Getattr(param, "tmap:in:disown"))) {
 	  Replaceall(paramTypemap, "$disown", "SWIG_POINTER_DISOWN");
 	} else {
@@ -543,6 +550,36 @@ public:
     return SWIG_OK;
   }
 
+  /* -----------------------------------------------------------------------
+   * outputPosition()
+   *
+   * Returns the position of the output value of the argout typemap of param,
+   * numbered as done in functionWrapper() once the function has been called.
+   * ----------------------------------------------------------------------- */
+
+  int outputPosition(Node *node, ParmList *parms, Parm *param) {
+    int position = 0;
+    String *returnTypemap = Swig_typemap_lookup("out", node, Swig_cresult_name(), 0);
+    if (returnTypemap && Len(returnTypemap) > 0) {
+      position++;
+    }
+    Delete(returnTypemap);
+
+    for (Parm *p = parms; p;) {
+      if (Getattr(p, "tmap:argout")) {
+	position++;
+	if (p == param) {
+	  return position;
+	}
+	p = Getattr(p, "tmap:argout:next");
+      } else {
+	p = nextSibling(p);
+      }
+    }
+    Swig_error(input_file, line_number, "No argout typemap for the output position of %s in function %s.\n", SwigType_str(Getattr(param, "type"), 0), Getattr(node, "sym:name"));
+    return 0;
+  }
+
   /* -----------------------------------------------------------------------
    * dispatchFunction()
    * ----------------------------------------------------------------------- */